@@ -0,0 +1,317 @@
+// Benchmark app built with Dear ImGui and ImPlot
+// This app does not output to any backend! It times parts of ImPlot on the CPU so that performance regressions are measurable in CI.
+// For each plot item type and data size it reports the CPU time spent in the PlotX call, the vertices and indices it
+// emitted, and the number of allocations it made, averaged over several frames.
+
+#include "imgui.h"
+#include "implot.h"
+#include "implot_internal.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "math.h"
+#include "stddef.h"
+#include <chrono>
+
+//-----------------------------------------------------------------------------
+// Utils
+//-----------------------------------------------------------------------------
+
+struct BenchmarkTimer {
+    std::chrono::high_resolution_clock::time_point Start;
+    BenchmarkTimer() { Start = std::chrono::high_resolution_clock::now(); }
+    double ElapsedUs() const { return std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - Start).count(); }
+};
+
+// Counts allocations made through ImGui's allocator (which ImPlot also uses)
+static int GAllocCount = 0;
+static void* BenchmarkMalloc(size_t size, void*) { GAllocCount++; return malloc(size); }
+static void  BenchmarkFree(void* ptr, void*)     { free(ptr); }
+
+//-----------------------------------------------------------------------------
+// Plot Items
+//-----------------------------------------------------------------------------
+
+struct BenchmarkData {
+    ImVector<float> Xs, Ys, Err;
+    void Generate(int count) {
+        Xs.resize(count); Ys.resize(count); Err.resize(count);
+        srand(0);
+        for (int i = 0; i < count; ++i) {
+            Xs[i]  = (float)i;
+            Ys[i]  = sinf(i * 0.01f) + (float)rand() / (float)RAND_MAX;
+            Err[i] = 0.1f;
+        }
+    }
+};
+
+typedef void (*BenchmarkPlotFunc)(const BenchmarkData& data, int count);
+
+static void BenchLine(const BenchmarkData& d, int n)       { ImPlot::PlotLine("##Line", d.Xs.Data, d.Ys.Data, n); }
+static void BenchLineOffset(const BenchmarkData& d, int n) { ImPlot::PlotLine("##LineOffset", d.Xs.Data, d.Ys.Data, n, {ImPlotProp_Offset, n / 2}); }
+static void BenchScatter(const BenchmarkData& d, int n)    { ImPlot::PlotScatter("##Scatter", d.Xs.Data, d.Ys.Data, n); }
+static void BenchStairs(const BenchmarkData& d, int n)     { ImPlot::PlotStairs("##Stairs", d.Xs.Data, d.Ys.Data, n); }
+static void BenchShaded(const BenchmarkData& d, int n)     { ImPlot::PlotShaded("##Shaded", d.Xs.Data, d.Ys.Data, n); }
+static void BenchBars(const BenchmarkData& d, int n)       { ImPlot::PlotBars("##Bars", d.Xs.Data, d.Ys.Data, n, 0.67); }
+static void BenchStems(const BenchmarkData& d, int n)      { ImPlot::PlotStems("##Stems", d.Xs.Data, d.Ys.Data, n); }
+static void BenchErrorBars(const BenchmarkData& d, int n)  { ImPlot::PlotErrorBars("##ErrorBars", d.Xs.Data, d.Ys.Data, d.Err.Data, n); }
+static void BenchDigital(const BenchmarkData& d, int n)    { ImPlot::PlotDigital("##Digital", d.Xs.Data, d.Ys.Data, n); }
+static void BenchHistogram(const BenchmarkData& d, int n)  { ImPlot::PlotHistogram("##Histogram", d.Ys.Data, n); }
+static void BenchHeatmap(const BenchmarkData& d, int n)    { const int side = (int)sqrtf((float)n); ImPlot::PlotHeatmap("##Heatmap", d.Ys.Data, side, side, 0, 0, nullptr); }
+
+// Many channels against one shared x array: #n samples in total, split across the channels
+static const int BenchChannelCount = 64;
+
+struct BenchmarkChannels {
+    char        Names[BenchChannelCount][16];
+    const char* Labels[BenchChannelCount];
+    BenchmarkChannels() {
+        for (int c = 0; c < BenchChannelCount; ++c) {
+            snprintf(Names[c], sizeof(Names[c]), "##Ch%d", c);
+            Labels[c] = Names[c];
+        }
+    }
+};
+
+static void BenchLineChannels(const BenchmarkData& d, int n) {
+    static BenchmarkChannels channels;
+    for (int c = 0; c < BenchChannelCount; ++c)
+        ImPlot::PlotLine(channels.Labels[c], d.Xs.Data, d.Ys.Data + c, n / BenchChannelCount);
+}
+
+static void BenchLines(const BenchmarkData& d, int n) {
+    static BenchmarkChannels channels;
+    const float* ys[BenchChannelCount];
+    for (int c = 0; c < BenchChannelCount; ++c)
+        ys[c] = d.Ys.Data + c;
+    ImPlot::PlotLines(channels.Labels, d.Xs.Data, ys, BenchChannelCount, n / BenchChannelCount);
+}
+
+struct BenchmarkPlotItem {
+    const char*       Name;
+    BenchmarkPlotFunc Func;
+};
+
+static void BenchmarkPlotItems() {
+    const BenchmarkPlotItem items[] = {
+        { "PlotLine",        BenchLine         },
+        { "PlotLine+Offset", BenchLineOffset   },
+        { "PlotLine x64",    BenchLineChannels },
+        { "PlotLines x64",   BenchLines        },
+        { "PlotScatter",     BenchScatter      },
+        { "PlotStairs",      BenchStairs       },
+        { "PlotShaded",      BenchShaded       },
+        { "PlotBars",        BenchBars         },
+        { "PlotStems",       BenchStems        },
+        { "PlotErrorBars",   BenchErrorBars    },
+        { "PlotDigital",     BenchDigital      },
+        { "PlotHistogram",   BenchHistogram    },
+        { "PlotHeatmap",     BenchHeatmap      },
+    };
+    const int sizes[]       = { 1000, 10000, 100000 };
+    const int warmup_frames = 3;
+    const int frames        = 20;
+    BenchmarkData data;
+    data.Generate(sizes[IM_ARRAYSIZE(sizes)-1]);
+    printf("%-16s %8s %12s %10s %10s %10s\n", "item", "count", "cpu (us)", "vtx", "idx", "allocs");
+    for (int it = 0; it < (int)IM_ARRAYSIZE(items); ++it) {
+        for (int sz = 0; sz < (int)IM_ARRAYSIZE(sizes); ++sz) {
+            double total_us = 0;
+            int vtx = 0, idx = 0, allocs = 0;
+            for (int f = 0; f < warmup_frames + frames; ++f) {
+                ImGui::NewFrame();
+                ImGui::SetNextWindowPos(ImVec2(0,0));
+                ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+                ImGui::Begin("Benchmark", nullptr, ImGuiWindowFlags_NoDecoration);
+                if (ImPlot::BeginPlot("##Benchmark", ImVec2(-1,-1))) {
+                    ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                    ImPlot::SetupFinish();
+                    ImDrawList& draw_list = *ImPlot::GetPlotDrawList();
+                    const int vtx0    = draw_list.VtxBuffer.Size;
+                    const int idx0    = draw_list.IdxBuffer.Size;
+                    const int allocs0 = GAllocCount;
+                    BenchmarkTimer timer;
+                    items[it].Func(data, sizes[sz]);
+                    const double us = timer.ElapsedUs();
+                    if (f >= warmup_frames) {
+                        total_us += us;
+                        vtx       = draw_list.VtxBuffer.Size - vtx0;
+                        idx       = draw_list.IdxBuffer.Size - idx0;
+                        allocs   += GAllocCount - allocs0;
+                    }
+                    ImPlot::EndPlot();
+                }
+                ImGui::End();
+                ImGui::Render();
+            }
+            printf("%-16s %8d %12.1f %10d %10d %10.1f\n", items[it].Name, sizes[sz], total_us / frames, vtx, idx, (double)allocs / frames);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Memory Mapped Files
+//-----------------------------------------------------------------------------
+
+struct BenchmarkRecord { float X, Y; };
+
+// Writes #count sorted records to a temporary file. Returns false if the file cannot be written.
+static bool WriteRecordFile(const char* filename, int count) {
+    FILE* f = fopen(filename, "wb");
+    if (f == nullptr)
+        return false;
+    BenchmarkRecord block[4096];
+    bool ok = true;
+    for (int i = 0; i < count && ok; i += IM_ARRAYSIZE(block)) {
+        const int n = ImMin(count - i, (int)IM_ARRAYSIZE(block));
+        for (int j = 0; j < n; ++j) {
+            block[j].X = (float)(i + j);
+            block[j].Y = sinf((i + j) * 0.001f);
+        }
+        ok = fwrite(block, sizeof(BenchmarkRecord), (size_t)n, f) == (size_t)n;
+    }
+    return fclose(f) == 0 && ok;
+}
+
+// Times PlotLineMapped over a generated temp file, zoomed to a window of 1000 records and fit to the whole file
+static void BenchmarkMappedFile() {
+    const char* filename = "benchmark_implot_records.bin";
+    const int sizes[]    = { 100000, 1000000, 10000000 };
+    const int frames     = 20;
+    printf("%-16s %10s %8s %12s %10s\n", "mapped file", "records", "view", "cpu (us)", "vtx");
+    for (int sz = 0; sz < (int)IM_ARRAYSIZE(sizes); ++sz) {
+        const int count = sizes[sz];
+        ImPlotMappedFile file;
+        if (!WriteRecordFile(filename, count) || !file.Open(filename) || file.Size != sizeof(BenchmarkRecord) * (size_t)count) {
+            printf("  failed to write or map %s with %d records\n", filename, count);
+            file.Close();
+            remove(filename);
+            continue;
+        }
+        for (int view = 0; view < 2; ++view) {
+            double total_us = 0;
+            int vtx = 0;
+            for (int f = 0; f < frames; ++f) {
+                ImGui::NewFrame();
+                ImGui::SetNextWindowPos(ImVec2(0,0));
+                ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+                ImGui::Begin("Benchmark", nullptr, ImGuiWindowFlags_NoDecoration);
+                if (ImPlot::BeginPlot("##Mapped", ImVec2(-1,-1))) {
+                    if (view == 0)
+                        ImPlot::SetupAxisLimits(ImAxis_X1, count / 2, count / 2 + 1000, ImGuiCond_Always);
+                    else
+                        ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+                    ImPlot::SetupFinish();
+                    ImDrawList& draw_list = *ImPlot::GetPlotDrawList();
+                    const int vtx0 = draw_list.VtxBuffer.Size;
+                    BenchmarkTimer timer;
+                    ImPlot::PlotLineMapped<float>("##Records", file, count, offsetof(BenchmarkRecord, X), offsetof(BenchmarkRecord, Y), {ImPlotProp_Stride, (int)sizeof(BenchmarkRecord)});
+                    total_us += timer.ElapsedUs();
+                    vtx = draw_list.VtxBuffer.Size - vtx0;
+                    ImPlot::EndPlot();
+                }
+                ImGui::End();
+                ImGui::Render();
+            }
+            printf("%-16s %10d %8s %12.1f %10d\n", "PlotLineMapped", count, view == 0 ? "1000" : "all", total_us / frames, vtx);
+        }
+        file.Close();
+        remove(filename);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Log Ticks
+//-----------------------------------------------------------------------------
+
+// Reference implementation of the logarithmic tick generator prior to the decade table rework (pow per tick)
+namespace Legacy {
+
+void AddTicksLogarithmic(const ImPlotRange& range, int exp_min, int exp_max, int exp_step, ImPlotTicker& ticker, ImPlotFormatter formatter, void* data) {
+    const double sign = ImSign(range.Max);
+    for (int e = exp_min - exp_step; e < (exp_max + exp_step); e += exp_step) {
+        double major1 = sign*ImPow(10, (double)(e));
+        double major2 = sign*ImPow(10, (double)(e + 1));
+        double interval = (major2 - major1) / 9;
+        if (major1 >= (range.Min - DBL_EPSILON) && major1 <= (range.Max + DBL_EPSILON))
+            ticker.AddTick(major1, true, 0, true, formatter, data);
+        for (int j = 0; j < exp_step; ++j) {
+            major1 = sign*ImPow(10, (double)(e+j));
+            major2 = sign*ImPow(10, (double)(e+j+1));
+            interval = (major2 - major1) / 9;
+            for (int i = 1; i < (9 + (int)(j < (exp_step - 1))); ++i) {
+                double minor = major1 + i * interval;
+                if (minor >= (range.Min - DBL_EPSILON) && minor <= (range.Max + DBL_EPSILON))
+                    ticker.AddTick(minor, false, 0, false, formatter, data);
+            }
+        }
+    }
+}
+
+void Locator_Log10(ImPlotTicker& ticker, const ImPlotRange& range, float pixels, bool vertical, ImPlotFormatter formatter, void* formatter_data) {
+    int exp_min, exp_max, exp_step;
+    if (ImPlot::CalcLogarithmicExponents(range, pixels, vertical, exp_min, exp_max, exp_step))
+        AddTicksLogarithmic(range, exp_min, exp_max, exp_step, ticker, formatter, formatter_data);
+}
+
+} // namespace Legacy
+
+static double TimeLocator(ImPlotLocator locator, const ImPlotRange& range, float pixels, int iterations, int* tick_count) {
+    ImPlotTicker ticker;
+    BenchmarkTimer timer;
+    for (int i = 0; i < iterations; ++i) {
+        ticker.Reset();
+        locator(ticker, range, pixels, false, ImPlot::Formatter_Default, (void*)IMPLOT_LABEL_FORMAT);
+    }
+    *tick_count = ticker.TickCount();
+    return timer.ElapsedUs() / iterations;
+}
+
+static void BenchmarkLogTicks() {
+    const int iterations = 2000;
+    const ImPlotRange ranges[] = { ImPlotRange(1, 1e3), ImPlotRange(1e-10, 1e10), ImPlotRange(1e-150, 1e150), ImPlotRange(1e-300, 1e300) };
+    const float pixels[] = { 400, 4000 };
+    printf("%-24s %8s %8s %12s %12s\n", "log10 range", "pixels", "ticks", "legacy (us)", "current (us)");
+    for (int r = 0; r < (int)IM_ARRAYSIZE(ranges); ++r) {
+        for (int p = 0; p < (int)IM_ARRAYSIZE(pixels); ++p) {
+            int ticks_legacy = 0, ticks_current = 0;
+            const double t_legacy  = TimeLocator(Legacy::Locator_Log10, ranges[r], pixels[p], iterations, &ticks_legacy);
+            const double t_current = TimeLocator(ImPlot::Locator_Log10, ranges[r], pixels[p], iterations, &ticks_current);
+            char label[32];
+            snprintf(label, sizeof(label), "[%g,%g]", ranges[r].Min, ranges[r].Max);
+            printf("%-24s %8.0f %8d %12.3f %12.3f\n", label, pixels[p], ticks_current, t_legacy, t_current);
+            if (ticks_legacy != ticks_current)
+                printf("  tick count mismatch: legacy=%d current=%d\n", ticks_legacy, ticks_current);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Main
+//-----------------------------------------------------------------------------
+
+int main(int, char**)
+{
+    printf("benchmark_implot: start\n");
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(BenchmarkMalloc, BenchmarkFree);
+    ImGui::CreateContext();
+    ImPlot::CreateContext();
+
+    // Additional imgui initialization needed when no backend is present
+    ImGui::GetIO().DisplaySize = ImVec2(1920.f, 1080.f);
+    ImGui::GetIO().Fonts->Build();
+
+    BenchmarkPlotItems();
+    BenchmarkMappedFile();
+
+    // tick labels are measured with CalcTextSize, which needs a current frame
+    ImGui::NewFrame();
+    BenchmarkLogTicks();
+    ImGui::Render();
+
+    ImPlot::DestroyContext();
+    ImGui::DestroyContext();
+    printf("benchmark_implot: end\n");
+    return 0;
+}
@@ -221,9 +221,25 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 #pragma GCC diagnostic ignored "-Wformat-nonliteral"    // warning: format not a string literal, format string not checked
 #endif
 
+// Atomic access to plain integers shared between threads, which keeps <atomic> out of implot.h
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+template <typename T> static inline T    ImAtomicLoadAcquire(const T* p) { IM_STATIC_ASSERT(sizeof(T) == sizeof(long)); return (T)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+template <typename T> static inline void ImAtomicStoreRelease(T* p, T v)  { IM_STATIC_ASSERT(sizeof(T) == sizeof(long)); _InterlockedExchange((volatile long*)p, (long)v); }
+template <typename T> static inline void ImAtomicAddRelaxed(T* p, T v)    { IM_STATIC_ASSERT(sizeof(T) == sizeof(long)); _InterlockedExchangeAdd((volatile long*)p, (long)v); }
+#else
+template <typename T> static inline T    ImAtomicLoadAcquire(const T* p) { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+template <typename T> static inline void ImAtomicStoreRelease(T* p, T v)  { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+template <typename T> static inline void ImAtomicAddRelaxed(T* p, T v)    { __atomic_fetch_add(p, v, __ATOMIC_RELAXED); }
+#endif
+
+// Lets another thread run while waiting for a worker (see ~ImPlotAsyncSeries). Defined with the platform code at the
+// end of this file, so that platform headers cannot leak macros into the rest of it.
+static void ImPlotThreadYield();
+
 // Global plot context
 #ifndef GImPlot
-ImPlotContext* GImPlot = nullptr;
+IMPLOT_THREAD_LOCAL ImPlotContext* GImPlot = nullptr;
 #endif
 
 //-----------------------------------------------------------------------------
@@ -265,6 +281,255 @@ ImPlotStyle::ImPlotStyle() {
     UseISO8601       = false;
 }
 
+ImPlotStreamBuffer::ImPlotStreamBuffer(int capacity, int queue_capacity) {
+    IM_ASSERT(capacity > 0);
+    if (queue_capacity <= 0)
+        queue_capacity = capacity;
+    // a power of two capacity lets the free running queue counters wrap around safely
+    unsigned int queue_size = 1;
+    while (queue_size < (unsigned int)queue_capacity)
+        queue_size <<= 1;
+    Capacity  = capacity;
+    Count     = 0;
+    Next      = 0;
+    Xs        = (double*)IM_ALLOC(sizeof(double) * capacity);
+    Ys        = (double*)IM_ALLOC(sizeof(double) * capacity);
+    QueueXs   = (double*)IM_ALLOC(sizeof(double) * queue_size);
+    QueueYs   = (double*)IM_ALLOC(sizeof(double) * queue_size);
+    QueueMask = queue_size - 1;
+    QueueHead = 0;
+    QueueTail = 0;
+    Dropped   = 0;
+}
+
+ImPlotStreamBuffer::~ImPlotStreamBuffer() {
+    IM_FREE(Xs);
+    IM_FREE(Ys);
+    IM_FREE(QueueXs);
+    IM_FREE(QueueYs);
+}
+
+bool ImPlotStreamBuffer::Push(double x, double y) {
+    const unsigned int head = QueueHead; // only written by this thread
+    const unsigned int tail = ImAtomicLoadAcquire(&QueueTail);
+    if (head - tail > QueueMask) {
+        ImAtomicAddRelaxed(&Dropped, 1u);
+        return false;
+    }
+    QueueXs[head & QueueMask] = x;
+    QueueYs[head & QueueMask] = y;
+    ImAtomicStoreRelease(&QueueHead, head + 1);
+    return true;
+}
+
+int ImPlotStreamBuffer::Update() {
+    const unsigned int tail = QueueTail; // only written by this thread
+    const unsigned int head = ImAtomicLoadAcquire(&QueueHead);
+    for (unsigned int i = tail; i != head; ++i) {
+        Xs[Next] = QueueXs[i & QueueMask];
+        Ys[Next] = QueueYs[i & QueueMask];
+        if (++Next == Capacity)
+            Next = 0;
+    }
+    const int moved = (int)(head - tail);
+    Count = ImMin(Count + moved, Capacity);
+    ImAtomicStoreRelease(&QueueTail, head);
+    return moved;
+}
+
+void ImPlotDecimatedSeries::Append(double x, double y) {
+    IM_ASSERT_USER_ERROR(Xs.Size == 0 || x >= Xs.back(), "ImPlotDecimatedSeries x values must be non-decreasing!");
+    const int idx = Xs.Size;
+    Xs.push_back(x);
+    Ys.push_back(y);
+    // the new sample either starts a bin or extends the last bin of each level
+    int span = LevelFactor;
+    for (int k = 0; k < LevelCount; ++k, span *= LevelFactor) {
+        ImVector<ImPlotMinMaxBin>& level = Levels[k];
+        if (idx % span == 0) {
+            ImPlotMinMaxBin bin;
+            bin.X0 = bin.X1 = x;
+            bin.YMin = bin.YMax = y;
+            bin.MinFirst = true;
+            level.push_back(bin);
+        }
+        else {
+            ImPlotMinMaxBin& bin = level.back();
+            bin.X1 = x;
+            if (y < bin.YMin) {
+                bin.YMin     = y;
+                bin.MinFirst = false;
+            }
+            else if (y > bin.YMax) {
+                bin.YMax     = y;
+                bin.MinFirst = true;
+            }
+        }
+        // the next span would overflow an int
+        if (span > INT_MAX / LevelFactor)
+            break;
+    }
+}
+
+void ImPlotDecimatedSeries::Clear() {
+    Xs.shrink(0);
+    Ys.shrink(0);
+    for (int k = 0; k < LevelCount; ++k)
+        Levels[k].shrink(0);
+}
+
+ImPlotAsyncSeries::ImPlotAsyncSeries(ImPlotAsyncTask task, void* task_data) {
+    IM_ASSERT_USER_ERROR(task != nullptr, "ImPlotAsyncSeries needs a task callback!");
+    JobX      = JobY    = ImPlotAsyncAxis();
+    ResultX   = ResultY = ImPlotAsyncAxis();
+    Staged    = false;
+    HasResult = false;
+    Task      = task;
+    TaskData  = task_data;
+    State     = State_Idle;
+}
+
+ImPlotAsyncSeries::~ImPlotAsyncSeries() {
+    while (Busy())
+        ImPlotThreadYield();
+}
+
+bool ImPlotAsyncSeries::Busy() const {
+    return ImAtomicLoadAcquire(&State) == State_Running;
+}
+
+void ImPlotAsyncSeries::Abandon() {
+    if (ImAtomicLoadAcquire(&State) == State_Running)
+        ImAtomicStoreRelease(&State, (int)State_Idle);
+}
+
+void ImPlotAsyncSeries::Submit(const double* xs, const double* ys, int count) {
+    count = ImMax(count, 0);
+    StagedXs.resize(count);
+    StagedYs.resize(count);
+    if (count > 0) {
+        memcpy(StagedXs.Data, xs, sizeof(double) * count);
+        memcpy(StagedYs.Data, ys, sizeof(double) * count);
+    }
+    Staged = true;
+}
+
+static bool AsyncAxisEqual(const ImPlotAsyncAxis& a, const ImPlotAsyncAxis& b) {
+    return a.Min == b.Min && a.Max == b.Max && a.Pixels == b.Pixels && a.Transform == b.Transform && a.TransformData == b.TransformData;
+}
+
+bool ImPlotAsyncSeries::Update(const ImPlotAsyncAxis& x_axis, const ImPlotAsyncAxis& y_axis) {
+    bool completed = false;
+    if (ImAtomicLoadAcquire(&State) == State_Done) {
+        Points.swap(JobPoints);
+        ResultX   = JobX;
+        ResultY   = JobY;
+        Bounds    = JobBounds;
+        HasResult = true;
+        completed = true;
+        ImAtomicStoreRelease(&State, (int)State_Idle);
+    }
+    if (ImAtomicLoadAcquire(&State) != State_Idle)
+        return completed;
+    const bool stale = !HasResult || !AsyncAxisEqual(x_axis, ResultX) || y_axis.Transform != ResultY.Transform || y_axis.TransformData != ResultY.TransformData;
+    if (!Staged && !(stale && JobXs.Size > 0))
+        return completed;
+    if (Staged) {
+        JobXs.swap(StagedXs);
+        JobYs.swap(StagedYs);
+        Staged = false;
+    }
+    JobX = x_axis;
+    JobY = y_axis;
+    // at most four points per pixel column plus the samples beyond each edge; reserved here so that jobs never allocate
+    JobPoints.resize(0);
+    JobPoints.reserve(4 * ((int)ImAbs(x_axis.Pixels) + 4));
+    ImAtomicStoreRelease(&State, (int)State_Running);
+    Task(&ImPlotAsyncSeries::Run, this, TaskData);
+    return completed;
+}
+
+static inline double AsyncToPixels(const ImPlotAsyncAxis& axis, double v) {
+    const double s = axis.Transform != nullptr ? axis.Transform(v, axis.TransformData) : v;
+    return axis.Pixels * (s - axis.ScaleMin) / (axis.ScaleMax - axis.ScaleMin);
+}
+
+static inline void AsyncEmit(ImPlotAsyncSeries& series, int idx) {
+    // unsorted x values can exceed the reserved points, which are then dropped rather than reallocated off the UI thread
+    if (series.JobPoints.Size < series.JobPoints.Capacity)
+        series.JobPoints.push_back(ImVec2((float)AsyncToPixels(series.JobX, series.JobXs[idx]), (float)AsyncToPixels(series.JobY, series.JobYs[idx])));
+}
+
+// Emits the first, min, max and last samples of a pixel column in the order they occurred
+static inline void AsyncEmitColumn(ImPlotAsyncSeries& series, int first, int lo, int hi, int last) {
+    const int a = ImMin(lo, hi), b = ImMax(lo, hi);
+    AsyncEmit(series, first);
+    if (a != first)
+        AsyncEmit(series, a);
+    if (b != a)
+        AsyncEmit(series, b);
+    if (last != b)
+        AsyncEmit(series, last);
+}
+
+void ImPlotAsyncSeries::Run(void* data) {
+    ImPlotAsyncSeries& series = *(ImPlotAsyncSeries*)data;
+    // pairs with the release in Update, in case the task callback does not synchronize by itself
+    (void)ImAtomicLoadAcquire(&series.State);
+    const double* xs = series.JobXs.Data;
+    const double* ys = series.JobYs.Data;
+    const int n      = series.JobXs.Size;
+    // data extents for fitting (x is sorted)
+    series.JobBounds = ImPlotRect(NAN, NAN, NAN, NAN);
+    if (n > 0) {
+        series.JobBounds.X = ImPlotRange(xs[0], xs[n - 1]);
+        for (int i = 0; i < n; ++i) {
+            if (ImNan(ys[i]))
+                continue;
+            if (!(ys[i] >= series.JobBounds.Y.Min))
+                series.JobBounds.Y.Min = ys[i];
+            if (!(ys[i] <= series.JobBounds.Y.Max))
+                series.JobBounds.Y.Max = ys[i];
+        }
+    }
+    // visible samples, keeping one beyond each edge so that lines leaving the plot area are still drawn
+    int i0 = 0, hi = n;
+    while (i0 < hi) {
+        const int mid = i0 + (hi - i0) / 2;
+        if (xs[mid] < series.JobX.Min) i0 = mid + 1; else hi = mid;
+    }
+    int i1 = i0;
+    hi = n;
+    while (i1 < hi) {
+        const int mid = i1 + (hi - i1) / 2;
+        if (xs[mid] < series.JobX.Max) i1 = mid + 1; else hi = mid;
+    }
+    i0 = ImMax(i0 - 1, 0);
+    i1 = ImMin(i1 + 1, n);
+    // M4 decimation: one run of samples per pixel column
+    int first = -1, lo = 0, top = 0, last = 0;
+    double col = 0;
+    for (int i = i0; i < i1; ++i) {
+        if (ImNan(xs[i]) || ImNan(ys[i]))
+            continue;
+        const double c = floor(AsyncToPixels(series.JobX, xs[i]));
+        if (first < 0 || c != col) {
+            if (first >= 0)
+                AsyncEmitColumn(series, first, lo, top, last);
+            first = lo = top = last = i;
+            col   = c;
+        }
+        else {
+            if (ys[i] < ys[lo])  lo  = i;
+            if (ys[i] > ys[top]) top = i;
+            last = i;
+        }
+    }
+    if (first >= 0)
+        AsyncEmitColumn(series, first, lo, top, last);
+    ImAtomicStoreRelease(&series.State, (int)State_Done);
+}
+
 //-----------------------------------------------------------------------------
 // Style
 //-----------------------------------------------------------------------------
@@ -502,6 +767,9 @@ void Initialize(ImPlotContext* ctx) {
     ResetCtxForNextPlot(ctx);
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
+    ctx->FrameCount = -1;
+    ctx->StatsEnabled = false;
+    ctx->LastPlotChanges = ImPlotChangeFlags_None;
 
     const ImU32 Deep[]     = {IM_RGB(76,114,176),IM_RGB(221,132,82),IM_RGB(85,168,104),IM_RGB(196,78,82),IM_RGB(129,114,179),IM_RGB(147,120,96),IM_RGB(218,139,195),IM_RGB(140,140,140),IM_RGB(204,185,116),IM_RGB(100,181,205)};
     const ImU32 Dark[]     = {IM_RGB(228,26,28),IM_RGB(55,126,184),IM_RGB(77,175,74),IM_RGB(152,78,163),IM_RGB(255,127,0),IM_RGB(255,255,51),IM_RGB(166,86,40),IM_RGB(247,129,191),IM_RGB(153,153,153)};
@@ -567,6 +835,14 @@ void ResetCtxForNextSubplot(ImPlotContext* ctx) {
     ctx->CurrentAlignmentV   = nullptr;
 }
 
+void ResetCtxForNextFrame(ImPlotContext* ctx) {
+    if (ctx->FrameCount == GImGui->FrameCount)
+        return;
+    ctx->FrameCount = GImGui->FrameCount;
+    ctx->FrameArena.Reset();
+    ctx->TickerCache.Reset();
+}
+
 //-----------------------------------------------------------------------------
 // Plot Utils
 //-----------------------------------------------------------------------------
@@ -612,6 +888,7 @@ ImVec2 GetLocationPos(const ImRect& outer_rect, const ImVec2& inner_size, ImPlot
 }
 
 ImVec2 CalcLegendSize(ImPlotItemGroup& items, const ImVec2& pad, const ImVec2& spacing, bool vertical) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::CalcLegendSize");
     // vars
     const int   nItems      = items.GetLegendCount();
     const float txt_ht      = ImGui::GetTextLineHeight();
@@ -620,8 +897,7 @@ ImVec2 CalcLegendSize(ImPlotItemGroup& items, const ImVec2& pad, const ImVec2& s
     float max_label_width = 0;
     float sum_label_width = 0;
     for (int i = 0; i < nItems; ++i) {
-        const char* label       = items.GetLegendLabel(i);
-        const float label_width = ImGui::CalcTextSize(label, nullptr, true).x;
+        const float label_width = items.GetLegendLabelWidth(i);
         max_label_width         = label_width > max_label_width ? label_width : max_label_width;
         sum_label_width        += label_width;
     }
@@ -654,16 +930,41 @@ bool ClampLegendRect(ImRect& legend_rect, const ImRect& outer_rect, const ImVec2
     return clamped;
 }
 
-int LegendSortingComp(const void* _a, const void* _b) {
-    ImPlotItemGroup* items = GImPlot->SortItems;
-    const int a = *(const int*)_a;
-    const int b = *(const int*)_b;
-    const char* label_a = items->GetLegendLabel(a);
-    const char* label_b = items->GetLegendLabel(b);
-    return strcmp(label_a,label_b);
+struct ImPlotLegendSortEntry {
+    const char* Label;
+    int         Index;
+};
+
+// Orders by label, then by submission order so that equal labels keep a stable order
+static int IMGUI_CDECL LegendSortingComp(const void* _a, const void* _b) {
+    const ImPlotLegendSortEntry& a = *(const ImPlotLegendSortEntry*)_a;
+    const ImPlotLegendSortEntry& b = *(const ImPlotLegendSortEntry*)_b;
+    const int cmp = strcmp(a.Label, b.Label);
+    return cmp != 0 ? cmp : a.Index - b.Index;
+}
+
+// Returns the sorted legend render order, only sorting again if the legend labels changed since the last sort
+static const int* GetSortedLegendIndices(ImPlotItemGroup& items) {
+    ImPlotLegend& legend    = items.Legend;
+    const int num_items     = items.GetLegendCount();
+    const ImGuiID signature = items.GetLegendLabelsHash();
+    if (legend.SortedIndices.Size != num_items || legend.SortedSignature != signature) {
+        ImPlotLegendSortEntry* entries = GImPlot->FrameArena.AllocArray<ImPlotLegendSortEntry>(num_items);
+        for (int i = 0; i < num_items; ++i) {
+            entries[i].Label = items.GetLegendLabel(i);
+            entries[i].Index = i;
+        }
+        ImQsort(entries, (size_t)num_items, sizeof(ImPlotLegendSortEntry), LegendSortingComp);
+        legend.SortedIndices.resize(num_items);
+        for (int i = 0; i < num_items; ++i)
+            legend.SortedIndices[i] = entries[i].Index;
+        legend.SortedSignature = signature;
+    }
+    return legend.SortedIndices.Data;
 }
 
 bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool hovered, const ImVec2& pad, const ImVec2& spacing, bool vertical, ImDrawList& DrawList) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::ShowLegendEntries");
     // vars
     const float txt_ht      = ImGui::GetTextLineHeight();
     const float icon_size   = txt_ht;
@@ -678,25 +979,35 @@ bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool hov
     if (num_items < 1)
         return hovered;
     // build render order
-    ImPlotContext& gp = *GImPlot;
-    ImVector<int>& indices = gp.TempInt1;
-    indices.resize(num_items);
-    for (int i = 0; i < num_items; ++i)
-        indices[i] = i;
-    if (ImHasFlag(items.Legend.Flags, ImPlotLegendFlags_Sort) && num_items > 1) {
-        gp.SortItems = &items;
-        qsort(indices.Data, num_items, sizeof(int), LegendSortingComp);
+    const int* sorted = ImHasFlag(items.Legend.Flags, ImPlotLegendFlags_Sort) && num_items > 1 ? GetSortedLegendIndices(items) : nullptr;
+    const bool reverse = ImHasFlag(items.Legend.Flags, ImPlotLegendFlags_Reverse);
+    // only entries inside the clip rect (the visible part of a scrolled legend) are laid out and submitted
+    const ImVec2 clip_min = DrawList.GetClipRectMin();
+    const ImVec2 clip_max = DrawList.GetClipRectMax();
+    int i_begin = 0, i_end = num_items;
+    if (vertical) {
+        const float step  = txt_ht + spacing.y;
+        const float top0  = legend_bb.Min.y + pad.y;
+        i_begin = ImClamp((int)ImFloor((clip_min.y - top0) / step), 0, num_items);
+        i_end   = ImClamp((int)((clip_max.y - top0) / step) + 1, i_begin, num_items);
     }
     // render
-    for (int i = 0; i < num_items; ++i) {
-        const int idx           = ImHasFlag(items.Legend.Flags, ImPlotLegendFlags_Reverse) ? indices[num_items - 1 - i] : indices[i];
-        ImPlotItem* item        = items.GetLegendItem(idx);
-        const char* label       = items.GetLegendLabel(idx);
-        const float label_width = ImGui::CalcTextSize(label, nullptr, true).x;
+    for (int i = i_begin; i < i_end; ++i) {
+        const int order         = reverse ? num_items - 1 - i : i;
+        const int idx           = sorted != nullptr ? sorted[order] : order;
+        const float label_width = items.GetLegendLabelWidth(idx);
         const ImVec2 top_left   = vertical ?
                                   legend_bb.Min + pad + ImVec2(0, i * (txt_ht + spacing.y)) :
                                   legend_bb.Min + pad + ImVec2(i * (icon_size + spacing.x) + sum_label_width, 0);
         sum_label_width        += label_width;
+        if (!vertical) {
+            if (top_left.x > clip_max.x)
+                break;
+            if (top_left.x + icon_size + label_width < clip_min.x)
+                continue;
+        }
+        ImPlotItem* item        = items.GetLegendItem(idx);
+        const char* label       = items.GetLegendLabel(idx);
         ImRect icon_bb;
         icon_bb.Min = top_left + ImVec2(icon_shrink,icon_shrink);
         icon_bb.Max = top_left + ImVec2(icon_size - icon_shrink, icon_size - icon_shrink);
@@ -816,22 +1127,45 @@ bool CalcLogarithmicExponents(const ImPlotRange& range, float pix, bool vertical
     return false;
 }
 
+// Decades representable by a double
+constexpr int LOG_TICKS_EXP_MIN = -323;
+constexpr int LOG_TICKS_EXP_MAX =  308;
+
+// Table of powers of ten, computed once so that log tick generation needs no per-tick pow
+struct ImPlotDecadeTable {
+    double Pow10[LOG_TICKS_EXP_MAX - LOG_TICKS_EXP_MIN + 1];
+    ImPlotDecadeTable() {
+        for (int e = LOG_TICKS_EXP_MIN; e <= LOG_TICKS_EXP_MAX; ++e)
+            Pow10[e - LOG_TICKS_EXP_MIN] = ImPow(10.0, (double)e);
+    }
+};
+
+static inline double DecadePow10(int e) {
+    static const ImPlotDecadeTable table;
+    if (e < LOG_TICKS_EXP_MIN || e > LOG_TICKS_EXP_MAX)
+        return ImPow(10.0, (double)e);
+    return table.Pow10[e - LOG_TICKS_EXP_MIN];
+}
+
 void AddTicksLogarithmic(const ImPlotRange& range, int exp_min, int exp_max, int exp_step, ImPlotTicker& ticker, ImPlotFormatter formatter, void* data) {
     const double sign = ImSign(range.Max);
+    const double lo   = range.Min - DBL_EPSILON;
+    const double hi   = range.Max + DBL_EPSILON;
     for (int e = exp_min - exp_step; e < (exp_max + exp_step); e += exp_step) {
-        double major1 = sign*ImPow(10, (double)(e));
-        double major2 = sign*ImPow(10, (double)(e + 1));
-        double interval = (major2 - major1) / 9;
-        if (major1 >= (range.Min - DBL_EPSILON) && major1 <= (range.Max + DBL_EPSILON))
-            ticker.AddTick(major1, true, 0, true, formatter, data);
+        const double major = sign * DecadePow10(e);
+        if (major >= lo && major <= hi)
+            ticker.AddTick(major, true, 0, true, formatter, data);
         for (int j = 0; j < exp_step; ++j) {
-            major1 = sign*ImPow(10, (double)(e+j));
-            major2 = sign*ImPow(10, (double)(e+j+1));
-            interval = (major2 - major1) / 9;
-            for (int i = 1; i < (9 + (int)(j < (exp_step - 1))); ++i) {
-                double minor = major1 + i * interval;
-                if (minor >= (range.Min - DBL_EPSILON) && minor <= (range.Max + DBL_EPSILON))
-                    ticker.AddTick(minor, false, 0, false, formatter, data);
+            const double decade = sign * DecadePow10(e + j);
+            // skip decades that don't intersect the range
+            if (ImMax(decade, decade * 10) < lo || ImMin(decade, decade * 10) > hi)
+                continue;
+            // minors are 2x..9x the decade (and 10x if the next decade isn't a major); they are never labeled
+            const int mult_max = 9 + (int)(j < (exp_step - 1));
+            for (int m = 2; m <= mult_max; ++m) {
+                const double minor = decade * m;
+                if (minor >= lo && minor <= hi)
+                    ticker.AddTick(ImPlotTick(minor, false, 0, false));
             }
         }
     }
@@ -1689,7 +2023,7 @@ void PadAndDatumAxesX(ImPlotPlot& plot, float& pad_T, float& pad_B, ImPlotAlignm
             if (count_T++ > 0)
                 pad_T += K + P;
             if (label) {
-                ImVec2 label_size = ImGui::CalcTextSize(plot.GetAxisLabel(axis));
+                ImVec2 label_size = axis.LabelSize.Calc(plot.GetAxisLabel(axis), false);
                 pad_T += label_size.y + P;
             }
             if (ticks)
@@ -1702,7 +2036,7 @@ void PadAndDatumAxesX(ImPlotPlot& plot, float& pad_T, float& pad_B, ImPlotAlignm
             if (count_B++ > 0)
                 pad_B += K + P;
             if (label) {
-                ImVec2 label_size = ImGui::CalcTextSize(plot.GetAxisLabel(axis));
+                ImVec2 label_size = axis.LabelSize.Calc(plot.GetAxisLabel(axis), false);
                 pad_B += label_size.y + P;
             }
             if (ticks)
@@ -1868,6 +2202,7 @@ constexpr float MOUSE_CURSOR_DRAG_THRESHOLD = 5.0f;
 constexpr float BOX_SELECT_DRAG_THRESHOLD   = 4.0f;
 
 bool UpdateInput(ImPlotPlot& plot) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::UpdateInput");
 
     bool changed = false;
 
@@ -2262,8 +2597,9 @@ void SetupAxisTicks(ImAxis idx, double v_min, double v_max, int n_ticks, const c
     IM_ASSERT_USER_ERROR(labels == nullptr || n_ticks >= 2,
                          "When providing custom labels, n_ticks must be at least 2!");
     n_ticks = n_ticks < 2 ? 2 : n_ticks;
-    FillRange(gp.TempDouble1, n_ticks, v_min, v_max);
-    SetupAxisTicks(idx, gp.TempDouble1.Data, n_ticks, labels, show_default);
+    double* values = gp.FrameArena.AllocArray<double>(n_ticks);
+    FillRange(values, n_ticks, v_min, v_max);
+    SetupAxisTicks(idx, values, n_ticks, labels, show_default);
 }
 
 void SetupAxisScale(ImAxis idx, ImPlotScale scale) {
@@ -2415,14 +2751,178 @@ void SetNextAxesToFit() {
         SetNextAxisToFit(i);
 }
 
+void SetNextPlotContentHash(ImGuiID hash) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "SetNextPlotContentHash() needs to be called before BeginPlot()!");
+    gp.NextPlotData.ContentHash    = hash;
+    gp.NextPlotData.HasContentHash = true;
+}
+
+//-----------------------------------------------------------------------------
+// Retained Plots
+//-----------------------------------------------------------------------------
+
+// Combines the user's content hash with everything outside of the plot's content that affects its draw output
+static ImGuiID CalcRetainedKey(const ImPlotPlot& plot, const char* title_id, ImGuiID content_hash) {
+    ImGuiContext& G   = *GImGui;
+    ImPlotContext& gp = *GImPlot;
+    ImDrawList& DrawList = *G.CurrentWindow->DrawList;
+    const ImVec2 frame_size = plot.FrameRect.GetSize();
+    const ImVec4 clip_rect(DrawList.GetClipRectMin().x - plot.FrameRect.Min.x, DrawList.GetClipRectMin().y - plot.FrameRect.Min.y,
+                           DrawList.GetClipRectMax().x - plot.FrameRect.Min.x, DrawList.GetClipRectMax().y - plot.FrameRect.Min.y);
+    ImGuiID key = ImHashStr(title_id, 0, content_hash);
+    key = ImHashData(&plot.Flags, sizeof(plot.Flags), key);
+    key = ImHashData(&frame_size, sizeof(frame_size), key);
+    key = ImHashData(&clip_rect, sizeof(clip_rect), key);
+    // hash the style field by field: its padding bytes are indeterminate after copies
+    const ImPlotStyle& style = gp.Style;
+    const bool time_flags[3] = { style.UseLocalTime, style.UseISO8601, style.Use24HourClock };
+    key = ImHashData(&style.PlotDefaultSize, sizeof(ImVec2), key);
+    key = ImHashData(&style.PlotMinSize, sizeof(ImVec2), key);
+    key = ImHashData(&style.MajorTickLen, sizeof(ImVec2), key);
+    key = ImHashData(&style.MinorTickLen, sizeof(ImVec2), key);
+    key = ImHashData(&style.MajorTickSize, sizeof(ImVec2), key);
+    key = ImHashData(&style.MinorTickSize, sizeof(ImVec2), key);
+    key = ImHashData(&style.MajorGridSize, sizeof(ImVec2), key);
+    key = ImHashData(&style.MinorGridSize, sizeof(ImVec2), key);
+    key = ImHashData(&style.PlotPadding, sizeof(ImVec2), key);
+    key = ImHashData(&style.LabelPadding, sizeof(ImVec2), key);
+    key = ImHashData(&style.LegendPadding, sizeof(ImVec2), key);
+    key = ImHashData(&style.LegendInnerPadding, sizeof(ImVec2), key);
+    key = ImHashData(&style.LegendSpacing, sizeof(ImVec2), key);
+    key = ImHashData(&style.MousePosPadding, sizeof(ImVec2), key);
+    key = ImHashData(&style.AnnotationPadding, sizeof(ImVec2), key);
+    key = ImHashData(&style.FitPadding, sizeof(ImVec2), key);
+    key = ImHashData(&style.PlotBorderSize, sizeof(float), key);
+    key = ImHashData(&style.MinorAlpha, sizeof(float), key);
+    key = ImHashData(&style.DigitalPadding, sizeof(float), key);
+    key = ImHashData(&style.DigitalSpacing, sizeof(float), key);
+    key = ImHashData(style.Colors, sizeof(style.Colors), key);
+    key = ImHashData(&style.Colormap, sizeof(style.Colormap), key);
+    key = ImHashData(time_flags, sizeof(time_flags), key);
+    key = ImHashData(G.Style.Colors, sizeof(G.Style.Colors), key);
+    key = ImHashData(&G.Style.Alpha, sizeof(G.Style.Alpha), key);
+    key = ImHashData(&G.Font, sizeof(G.Font), key);
+    key = ImHashData(&G.FontSize, sizeof(G.FontSize), key);
+    // glyph UVs move when the font atlas is rebuilt or resized
+    key = ImHashData(&G.IO.Fonts->TexUvWhitePixel, sizeof(ImVec2), key);
+    key = ImHashData(&G.IO.Fonts->TexUvScale, sizeof(ImVec2), key);
+    return key;
+}
+
+// Returns true if nothing is interacting with the plot, i.e. its draw output would not change if its content doesn't
+static bool IsPlotIdle(const ImPlotPlot& plot) {
+    ImGuiContext& G = *GImGui;
+    if (plot.Held || plot.Selecting || plot.ContextLocked)
+        return false;
+    for (int i = 0; i < ImAxis_COUNT; ++i) {
+        if (plot.Axes[i].Held)
+            return false;
+    }
+    if (ImGui::IsMouseHoveringRect(plot.FrameRect.Min, plot.FrameRect.Max, false))
+        return false;
+    // context menus and drag and drop payloads can change the plot without hovering it
+    return G.OpenPopupStack.Size == 0 && !G.DragDropActive;
+}
+
+// Returns true if the SetNext API requested changes to the upcoming plot's axes
+static bool HasNextPlotAxesData() {
+    ImPlotContext& gp = *GImPlot;
+    for (int i = 0; i < ImAxis_COUNT; ++i) {
+        if (gp.NextPlotData.HasRange[i] || gp.NextPlotData.Fit[i] || gp.NextPlotData.LinkedMin[i] || gp.NextPlotData.LinkedMax[i])
+            return true;
+    }
+    return false;
+}
+
+// Copies the draw commands emitted since the plot began capturing, relative to the plot frame origin
+static void CaptureRetainedPlot(ImPlotPlot& plot, const ImDrawList& draw_list) {
+    ImPlotRetainedDrawData& rd = plot.Retained;
+    rd.Clear();
+    const ImVec2 origin = plot.FrameRect.Min;
+    const int idx0 = rd.CaptureIdx0;
+    int first = draw_list.CmdBuffer.Size;
+    while (first > 0 && (int)(draw_list.CmdBuffer[first-1].IdxOffset + draw_list.CmdBuffer[first-1].ElemCount) > idx0)
+        --first;
+    for (int c = first; c < draw_list.CmdBuffer.Size; ++c) {
+        const ImDrawCmd& cmd = draw_list.CmdBuffer[c];
+        const int idx_begin  = ImMax((int)cmd.IdxOffset, idx0);
+        const int idx_end    = (int)(cmd.IdxOffset + cmd.ElemCount);
+        if (idx_end <= idx_begin)
+            continue;
+        // callbacks can't be replayed safely
+        if (cmd.UserCallback != nullptr) {
+            rd.Clear();
+            return;
+        }
+        unsigned int vtx_min = ~0u, vtx_max = 0;
+        for (int i = idx_begin; i < idx_end; ++i) {
+            const unsigned int v = cmd.VtxOffset + draw_list.IdxBuffer[i];
+            vtx_min = ImMin(vtx_min, v);
+            vtx_max = ImMax(vtx_max, v);
+        }
+        ImPlotRetainedCmd rc;
+        rc.Cmd           = cmd;
+        rc.Cmd.ClipRect  = ImVec4(cmd.ClipRect.x - origin.x, cmd.ClipRect.y - origin.y, cmd.ClipRect.z - origin.x, cmd.ClipRect.w - origin.y);
+        rc.VtxOffset     = rd.VtxBuffer.Size;
+        rc.VtxCount      = (int)(vtx_max - vtx_min + 1);
+        rc.IdxOffset     = rd.IdxBuffer.Size;
+        rc.IdxCount      = idx_end - idx_begin;
+        rd.VtxBuffer.resize(rc.VtxOffset + rc.VtxCount);
+        for (int v = 0; v < rc.VtxCount; ++v) {
+            ImDrawVert vert = draw_list.VtxBuffer[(int)vtx_min + v];
+            vert.pos -= origin;
+            rd.VtxBuffer[rc.VtxOffset + v] = vert;
+        }
+        rd.IdxBuffer.resize(rc.IdxOffset + rc.IdxCount);
+        for (int i = 0; i < rc.IdxCount; ++i)
+            rd.IdxBuffer[rc.IdxOffset + i] = cmd.VtxOffset + draw_list.IdxBuffer[idx_begin + i] - vtx_min;
+        rd.Cmds.push_back(rc);
+    }
+    rd.Key   = rd.CaptureKey;
+    rd.Valid = true;
+}
+
+// Appends the captured draw commands of a retained plot at its current frame origin
+static void ReplayRetainedPlot(const ImPlotPlot& plot, ImDrawList& draw_list) {
+    const ImPlotRetainedDrawData& rd = plot.Retained;
+    const ImVec2 origin = plot.FrameRect.Min;
+    for (int c = 0; c < rd.Cmds.Size; ++c) {
+        const ImPlotRetainedCmd& rc = rd.Cmds[c];
+        const ImVec4& clip = rc.Cmd.ClipRect;
+        draw_list.PushClipRect(ImVec2(clip.x, clip.y) + origin, ImVec2(clip.z, clip.w) + origin);
+#ifdef IMGUI_HAS_TEXTURES
+        draw_list.PushTexture(rc.Cmd.TexRef);
+#else
+        draw_list.PushTextureID(rc.Cmd.TextureId);
+#endif
+        draw_list.PrimReserve(rc.IdxCount, rc.VtxCount);
+        const unsigned int base = draw_list._VtxCurrentIdx;
+        for (int i = 0; i < rc.IdxCount; ++i)
+            draw_list.PrimWriteIdx((ImDrawIdx)(base + rd.IdxBuffer[rc.IdxOffset + i]));
+        for (int v = 0; v < rc.VtxCount; ++v) {
+            const ImDrawVert& vert = rd.VtxBuffer[rc.VtxOffset + v];
+            draw_list.PrimWriteVtx(vert.pos + origin, vert.uv, vert.col);
+        }
+#ifdef IMGUI_HAS_TEXTURES
+        draw_list.PopTexture();
+#else
+        draw_list.PopTextureID();
+#endif
+        draw_list.PopClipRect();
+    }
+}
+
 //-----------------------------------------------------------------------------
 // BeginPlot
 //-----------------------------------------------------------------------------
 
 bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::BeginPlot");
     IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "Mismatched BeginPlot()/EndPlot()!");
+    ResetCtxForNextFrame(GImPlot);
 
     // FRONT MATTER -----------------------------------------------------------
 
@@ -2450,6 +2950,12 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
     plot.JustCreated         = just_created;
     plot.SetupLocked         = false;
 
+    // begin recording stats
+    if (gp.StatsEnabled) {
+        plot.CurrentStats = ImPlotPlotStats();
+        gp.StatsPlotStart = GetStatsTime();
+    }
+
     // check flags
     if (plot.JustCreated)
         plot.Flags = flags;
@@ -2502,6 +3008,25 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
         return false;
     }
 
+    // replay the draw output of an idle retained plot instead of rendering it again
+    plot.Retained.Capturing = false;
+    if (ImHasFlag(plot.Flags, ImPlotFlags_Retained) && gp.NextPlotData.HasContentHash && gp.CurrentSubplot == nullptr && gp.CurrentAlignmentH == nullptr && gp.CurrentAlignmentV == nullptr) {
+        const ImGuiID key = CalcRetainedKey(plot, title_id, gp.NextPlotData.ContentHash);
+        if (plot.Retained.Valid && plot.Retained.Key == key && IsPlotIdle(plot) && !HasNextPlotAxesData()) {
+            ReplayRetainedPlot(plot, *Window->DrawList);
+            plot.Changes       = ImPlotChangeFlags_None;
+            gp.LastPlotChanges = ImPlotChangeFlags_None;
+            ResetCtxForNextPlot(GImPlot);
+            return false;
+        }
+        plot.Retained.Capturing   = true;
+        plot.Retained.CaptureKey  = key;
+        plot.Retained.CaptureIdx0 = Window->DrawList->IdxBuffer.Size;
+    }
+    else if (plot.Retained.Valid) {
+        plot.Retained.Clear();
+    }
+
     // setup items (or dont)
     if (gp.CurrentItems == nullptr)
         gp.CurrentItems = &plot.Items;
@@ -2513,7 +3038,61 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
 // SetupFinish
 //-----------------------------------------------------------------------------
 
+// Runs the axis locator, or reuses the ticks of an axis located earlier this frame with identical inputs
+static void LocateAxisTicks(ImPlotAxis& axis, float pixels) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::LocateAxisTicks");
+    ImPlotContext& gp = *GImPlot;
+    ImPlotTickerCache& cache = gp.TickerCache;
+    ResetCtxForNextFrame(GImPlot);
+    ImPlotTickerKey key;
+    key.Range          = axis.Range;
+    key.Pixels         = pixels;
+    key.Vertical       = axis.Vertical;
+    key.Locator        = axis.Locator;
+    key.Formatter      = axis.Formatter;
+    key.FormatterData  = axis.FormatterData;
+    key.Format         = axis.Formatter == Formatter_Default ? (const char*)axis.FormatterData : nullptr;
+    key.Font           = ImGui::GetFont();
+    key.FontSize       = ImGui::GetFontSize();
+    key.UseLocalTime   = gp.Style.UseLocalTime;
+    key.UseISO8601     = gp.Style.UseISO8601;
+    key.Use24HourClock = gp.Style.Use24HourClock;
+    ImPlotTicker* shared = cache.Find(key);
+    if (shared == nullptr) {
+        shared = cache.Add(key);
+        axis.Locator(*shared, axis.Range, pixels, axis.Vertical, axis.Formatter, axis.FormatterData);
+    }
+    else {
+        cache.Hits++;
+    }
+    // append so that custom ticks added with SetupAxisTicks(...,keep_default=true) are preserved
+    ImPlotTicker& ticker = axis.Ticker;
+    const int text_off = ticker.TextBuffer.size();
+    ticker.TextBuffer.append(shared->TextBuffer.begin(), shared->TextBuffer.end());
+    ticker.Ticks.reserve(ticker.Ticks.Size + shared->Ticks.Size);
+    for (int t = 0; t < shared->Ticks.Size; ++t) {
+        ImPlotTick tick = shared->Ticks[t];
+        if (tick.TextOffset != -1)
+            tick.TextOffset += text_off;
+        ticker.AddTick(tick);
+    }
+}
+
+// Small multiples only process input for the cell that is hovered or being interacted with
+static bool SkipSmallMultipleInput(ImPlotPlot& plot) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.CurrentSubplot == nullptr || !gp.CurrentSubplot->Batched)
+        return false;
+    if (plot.Held || plot.Selecting || plot.ContextLocked || AnyAxesHeld(plot.Axes, ImAxis_COUNT) || plot.FrameRect.Contains(ImGui::GetIO().MousePos))
+        return false;
+    plot.Hovered = false;
+    for (int i = 0; i < ImAxis_COUNT; ++i)
+        plot.Axes[i].Hovered = false;
+    return true;
+}
+
 void SetupFinish() {
+    IMPLOT_PROFILE_SCOPE("ImPlot::SetupFinish");
     IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "SetupFinish needs to be called after BeginPlot!");
@@ -2524,6 +3103,8 @@ void SetupFinish() {
 
     ImPlotPlot &plot  = *gp.CurrentPlot;
 
+    const double setup_start = gp.StatsEnabled ? GetStatsTime() : 0;
+
     // lock setup
     plot.SetupLocked = true;
 
@@ -2606,7 +3187,7 @@ void SetupFinish() {
     // (0) calc top padding form title
     ImVec2 title_size(0.0f, 0.0f);
     if (plot.HasTitle())
-         title_size = ImGui::CalcTextSize(plot.GetTitle(), nullptr, true);
+         title_size = plot.TitleSize.Calc(plot.GetTitle(), true);
     if (title_size.x > 0) {
         pad_top += title_size.y + gp.Style.LabelPadding.y;
         plot.AxesRect.Min.y += gp.Style.PlotPadding.y + pad_top;
@@ -2621,7 +3202,7 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_Y_AXES; i++) {
         ImPlotAxis& axis = plot.YAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_height > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_height, true, axis.Formatter, axis.FormatterData);
+            LocateAxisTicks(axis, plot_height);
         }
     }
 
@@ -2634,7 +3215,7 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_X_AXES; i++) {
         ImPlotAxis& axis = plot.XAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_width > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_width, false, axis.Formatter, axis.FormatterData);
+            LocateAxisTicks(axis, plot_width);
         }
     }
 
@@ -2692,7 +3273,7 @@ void SetupFinish() {
     }
 
     // INPUT ------------------------------------------------------------------
-    if (!ImHasFlag(plot.Flags, ImPlotFlags_NoInputs))
+    if (!ImHasFlag(plot.Flags, ImPlotFlags_NoInputs) && !SkipSmallMultipleInput(plot))
         UpdateInput(plot);
 
     // fit from FitNextPlotAxes or auto fit
@@ -2755,7 +3336,7 @@ void SetupFinish() {
         const bool opp = ax.IsOpposite();
         if (ax.HasLabel()) {
             const char* label        = plot.GetAxisLabel(ax);
-            const ImVec2 label_size  = ImGui::CalcTextSize(label);
+            const ImVec2 label_size  = ax.LabelSize.Calc(label, false);
             const float label_offset = (ax.HasTickLabels() ? tkr.MaxSize.y + gp.Style.LabelPadding.y : 0.0f)
                                      + (tkr.Levels - 1) * (txt_height + gp.Style.LabelPadding.y)
                                      + gp.Style.LabelPadding.y;
@@ -2794,7 +3375,8 @@ void SetupFinish() {
         const bool opp = ax.IsOpposite();
         if (ax.HasLabel()) {
             const char* label        = plot.GetAxisLabel(ax);
-            const ImVec2 label_size  = CalcTextSizeVertical(label);
+            const ImVec2 label_hsize = ax.LabelSize.Calc(label, false);
+            const ImVec2 label_size(label_hsize.y, label_hsize.x);
             const float label_offset = (ax.HasTickLabels() ? tkr.MaxSize.x + gp.Style.LabelPadding.x : 0.0f)
                                      + gp.Style.LabelPadding.x;
             const ImVec2 label_pos(opp ? ax.Datum1 + label_offset : ax.Datum1 - label_offset - label_size.x,
@@ -2818,25 +3400,94 @@ void SetupFinish() {
     plot.Items.Legend.Reset();
     // push ID to set item hashes (NB: !!!THIS PROBABLY NEEDS TO BE IN BEGIN PLOT!!!!)
     ImGui::PushOverrideID(gp.CurrentItems->ID);
+
+    if (gp.StatsEnabled)
+        plot.CurrentStats.SetupTime = GetStatsTime() - setup_start;
 }
 
 //-----------------------------------------------------------------------------
 // EndPlot()
 //-----------------------------------------------------------------------------
 
+// Compares the plot state at the end of this frame with the previous frame
+static void UpdatePlotChanges(ImPlotPlot& plot, ImPlotItemGroup& items) {
+    ImPlotChangeState state;
+    for (int i = 0; i < ImAxis_COUNT; ++i) {
+        state.Ranges[i] = plot.Axes[i].Range;
+        if (plot.Axes[i].Enabled)
+            state.EnabledAxes |= 1 << i;
+    }
+    state.SizeHash = ImHashData(&plot.FrameRect, sizeof(plot.FrameRect), state.SizeHash);
+    state.SizeHash = ImHashData(&plot.PlotRect, sizeof(plot.PlotRect), state.SizeHash);
+    // item set, visibility and appearance
+    for (int i = 0; i < items.GetItemCount(); ++i) {
+        const ImPlotItem& item = *items.GetItemByIndex(i);
+        if (!item.SeenThisFrame)
+            continue;
+        state.ItemsHash = ImHashData(&item.ID, sizeof(item.ID), state.ItemsHash);
+        state.ItemsHash = ImHashData(&item.Show, sizeof(item.Show), state.ItemsHash);
+        state.ItemsHash = ImHashData(&item.Color, sizeof(item.Color), state.ItemsHash);
+        state.ItemsHash = ImHashData(&item.Marker, sizeof(item.Marker), state.ItemsHash);
+        if (item.LegendHovered)
+            state.HoverHash = ImHashData(&item.ID, sizeof(item.ID), state.HoverHash);
+    }
+    // hover state, and the mouse position while it affects the plot's mouse text and crosshairs
+    state.HoverHash = ImHashData(&plot.Hovered, sizeof(plot.Hovered), state.HoverHash);
+    state.HoverHash = ImHashData(&items.Legend.Hovered, sizeof(items.Legend.Hovered), state.HoverHash);
+    for (int i = 0; i < ImAxis_COUNT; ++i)
+        state.HoverHash = ImHashData(&plot.Axes[i].Hovered, sizeof(plot.Axes[i].Hovered), state.HoverHash);
+    if (plot.Hovered)
+        state.HoverHash = ImHashData(&ImGui::GetIO().MousePos, sizeof(ImVec2), state.HoverHash);
+    // box selection
+    state.SelectionHash = ImHashData(&plot.Selecting, sizeof(plot.Selecting), state.SelectionHash);
+    state.SelectionHash = ImHashData(&plot.Selected, sizeof(plot.Selected), state.SelectionHash);
+    if (plot.Selecting || plot.Selected)
+        state.SelectionHash = ImHashData(&plot.SelectRect, sizeof(plot.SelectRect), state.SelectionHash);
+
+    const ImPlotChangeState& prev = plot.ChangeState;
+    ImPlotChangeFlags changes = ImPlotChangeFlags_None;
+    if (!plot.Initialized) {
+        changes = ImPlotChangeFlags_All;
+    }
+    else {
+        bool limits = state.EnabledAxes != prev.EnabledAxes;
+        for (int i = 0; i < ImAxis_COUNT && !limits; ++i)
+            limits = plot.Axes[i].Enabled && (state.Ranges[i].Min != prev.Ranges[i].Min || state.Ranges[i].Max != prev.Ranges[i].Max);
+        if (limits)
+            changes |= ImPlotChangeFlags_Limits;
+        if (state.SizeHash != prev.SizeHash)
+            changes |= ImPlotChangeFlags_Size;
+        if (state.ItemsHash != prev.ItemsHash)
+            changes |= ImPlotChangeFlags_Items;
+        if (state.HoverHash != prev.HoverHash)
+            changes |= ImPlotChangeFlags_Hover;
+        if (state.SelectionHash != prev.SelectionHash)
+            changes |= ImPlotChangeFlags_Selection;
+    }
+    plot.ChangeState = state;
+    plot.Changes     = changes;
+    GImPlot->LastPlotChanges = changes;
+}
+
 void EndPlot() {
+    IMPLOT_PROFILE_SCOPE("ImPlot::EndPlot");
     IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "Mismatched BeginPlot()/EndPlot()!");
 
     SetupLock();
 
+    const double end_start = gp.StatsEnabled ? GetStatsTime() : 0;
+
     ImGuiContext &G       = *GImGui;
     ImPlotPlot &plot      = *gp.CurrentPlot;
     ImGuiWindow * Window  = G.CurrentWindow;
     ImDrawList & DrawList = *Window->DrawList;
     const ImGuiIO &   IO  = ImGui::GetIO();
 
+    // the draw output of a frame that fits its data doesn't match the ranges of the next frame
+    const bool fit_this_frame = plot.FitThisFrame;
+
     // FINAL RENDER -----------------------------------------------------------
 
     const bool render_border  = gp.Style.PlotBorderSize > 0 && GetStyleColorVec4(ImPlotCol_PlotBorder).w > 0;
@@ -3218,6 +3869,7 @@ void EndPlot() {
     // FIT DATA --------------------------------------------------------------
     const bool axis_equal = ImHasFlag(plot.Flags, ImPlotFlags_Equal);
     if (plot.FitThisFrame) {
+        IMPLOT_PROFILE_SCOPE("ImPlot::ApplyFit");
         for (int i = 0; i < IMPLOT_NUM_X_AXES; i++) {
             ImPlotAxis& x_axis = plot.XAxis(i);
             if (x_axis.FitThisFrame) {
@@ -3308,6 +3960,10 @@ void EndPlot() {
         plot.Axes[i].PushLinks();
 
 
+    // CHANGES ----------------------------------------------------------------
+
+    UpdatePlotChanges(plot, *gp.CurrentItems);
+
     // CLEANUP ----------------------------------------------------------------
 
     // remove items
@@ -3318,6 +3974,26 @@ void EndPlot() {
         plot.Items.GetItemByIndex(i)->SeenThisFrame = false;
     }
 
+    // capture the draw output for replay while the plot stays idle
+    if (plot.Retained.Capturing) {
+        plot.Retained.Capturing = false;
+        bool linked = false;
+        for (int i = 0; i < ImAxis_COUNT; ++i)
+            linked |= plot.Axes[i].LinkedMin != nullptr || plot.Axes[i].LinkedMax != nullptr;
+        if (plot.Initialized && !fit_this_frame && !linked && IsPlotIdle(plot))
+            CaptureRetainedPlot(plot, DrawList);
+        else
+            plot.Retained.Clear();
+    }
+
+    // finish recording stats
+    if (gp.StatsEnabled) {
+        const double now = GetStatsTime();
+        plot.CurrentStats.EndTime = now - end_start;
+        plot.CurrentStats.Time    = now - gp.StatsPlotStart;
+        plot.Stats = plot.CurrentStats;
+    }
+
     // mark the plot as initialized, i.e. having made it through one frame completely
     plot.Initialized = true;
     // Pop ImGui::PushID at the end of BeginPlot
@@ -3340,17 +4016,39 @@ constexpr float SUBPLOT_BORDER_SIZE             = 1.0f;
 constexpr float SUBPLOT_SPLITTER_HALF_THICKNESS = 4.0f;
 constexpr float SUBPLOT_SPLITTER_FEEDBACK_TIMER = 0.06f;
 
+// Identifies the inputs of a shared subplot legend's size, so that it is only measured when they change
+static ImGuiID CalcLegendSizeKey(ImPlotItemGroup& items, bool vertical) {
+    ImGuiContext& G   = *GImGui;
+    ImPlotContext& gp = *GImPlot;
+    const int count   = items.GetLegendCount();
+    const ImGuiID labels = items.GetLegendLabelsHash();
+    ImGuiID key = ImHashData(&labels, sizeof(labels), vertical ? 1 : 2);
+    key = ImHashData(&count, sizeof(count), key);
+    key = ImHashData(&G.Font, sizeof(G.Font), key);
+    key = ImHashData(&G.FontSize, sizeof(G.FontSize), key);
+    key = ImHashData(&gp.Style.LegendInnerPadding, sizeof(ImVec2), key);
+    key = ImHashData(&gp.Style.LegendSpacing, sizeof(ImVec2), key);
+    return key;
+}
+
+// Gets the size of a subplot's shared legend, reusing the last measurement if its inputs are unchanged
+static ImVec2 GetSubplotLegendSize(ImPlotSubplot& subplot, bool vertical) {
+    ImPlotContext& gp = *GImPlot;
+    const ImGuiID key = CalcLegendSizeKey(subplot.Items, vertical);
+    if (key != subplot.LegendSizeKey) {
+        subplot.LegendSize    = CalcLegendSize(subplot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, vertical);
+        subplot.LegendSizeKey = key;
+    }
+    return subplot.LegendSize;
+}
+
 void SubplotSetCell(int row, int col) {
     ImPlotContext& gp      = *GImPlot;
     ImPlotSubplot& subplot = *gp.CurrentSubplot;
     if (row >= subplot.Rows || col >= subplot.Cols)
         return;
-    float xoff = 0;
-    float yoff = 0;
-    for (int c = 0; c < col; ++c)
-        xoff += subplot.ColRatios[c];
-    for (int r = 0; r < row; ++r)
-        yoff += subplot.RowRatios[r];
+    const float xoff = subplot.ColOffsets[col];
+    const float yoff = subplot.RowOffsets[row];
     const ImVec2 grid_size = subplot.GridRect.GetSize();
     ImVec2 cpos            = subplot.GridRect.Min + ImVec2(xoff*grid_size.x,yoff*grid_size.y);
     cpos.x = IM_ROUND(cpos.x);
@@ -3409,6 +4107,7 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
     IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentSubplot == nullptr, "Mismatched BeginSubplots()/EndSubplots()!");
+    ResetCtxForNextFrame(GImPlot);
     ImGuiContext &G = *GImGui;
     ImGuiWindow * Window = G.CurrentWindow;
     if (Window->SkipItems)
@@ -3466,7 +4165,7 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
     // calc plot frame sizes
     ImVec2 title_size(0.0f, 0.0f);
     if (!ImHasFlag(subplot.Flags, ImPlotSubplotFlags_NoTitle))
-         title_size = ImGui::CalcTextSize(title, nullptr, true);
+         title_size = subplot.TitleSize.Calc(title, true);
     const float pad_top = title_size.x > 0.0f ? title_size.y + gp.Style.LabelPadding.y : 0;
     const ImVec2 half_pad = gp.Style.PlotPadding/2;
     const ImVec2 frame_size = ImGui::CalcItemSize(size, gp.Style.PlotDefaultSize.x, gp.Style.PlotDefaultSize.y);
@@ -3482,7 +4181,7 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
     if (share_items && !ImHasFlag(subplot.Flags, ImPlotSubplotFlags_NoLegend) && subplot.Items.GetLegendCount() > 0) {
         ImPlotLegend& legend = subplot.Items.Legend;
         const bool horz = ImHasFlag(legend.Flags, ImPlotLegendFlags_Horizontal);
-        const ImVec2 legend_size = CalcLegendSize(subplot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !horz);
+        const ImVec2 legend_size = GetSubplotLegendSize(subplot, !horz);
         const bool west = ImHasFlag(legend.Location, ImPlotLocation_West) && !ImHasFlag(legend.Location, ImPlotLocation_East);
         const bool east = ImHasFlag(legend.Location, ImPlotLocation_East) && !ImHasFlag(legend.Location, ImPlotLocation_West);
         const bool north = ImHasFlag(legend.Location, ImPlotLocation_North) && !ImHasFlag(legend.Location, ImPlotLocation_South);
@@ -3592,6 +4291,20 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
     PushStyleVar(ImPlotStyleVar_PlotMinSize, ImVec2(0,0));
     ImGui::PushStyleVar(ImGuiStyleVar_FrameBorderSize,0);
 
+    // cache cumulative ratios so that placing a cell doesn't sum over the preceding rows/cols
+    subplot.RowOffsets.resize(rows);
+    subplot.ColOffsets.resize(cols);
+    float offset = 0;
+    for (int r = 0; r < rows; ++r) {
+        subplot.RowOffsets[r] = offset;
+        offset += subplot.RowRatios[r];
+    }
+    offset = 0;
+    for (int c = 0; c < cols; ++c) {
+        subplot.ColOffsets[c] = offset;
+        offset += subplot.ColRatios[c];
+    }
+
     // set initial cursor pos
     Window->DC.CursorPos = subplot.GridRect.Min;
     // begin alignments
@@ -3632,7 +4345,7 @@ void EndSubplots() {
     if (share_items && !ImHasFlag(subplot.Flags, ImPlotSubplotFlags_NoLegend) && subplot.Items.GetLegendCount() > 0) {
         ImPlotLegend& legend = subplot.Items.Legend;
         const bool   legend_horz = ImHasFlag(legend.Flags, ImPlotLegendFlags_Horizontal);
-        const ImVec2 legend_size = CalcLegendSize(subplot.Items, gp.Style.LegendInnerPadding, gp.Style.LegendSpacing, !legend_horz);
+        const ImVec2 legend_size = GetSubplotLegendSize(subplot, !legend_horz);
         const ImVec2 legend_pos  = GetLocationPos(subplot.FrameRect, legend_size, legend.Location, gp.Style.PlotPadding);
         legend.Rect = ImRect(legend_pos, legend_pos + legend_size);
         legend.RectClamped = legend.Rect;
@@ -3711,6 +4424,54 @@ void EndSubplots() {
 
 }
 
+//-----------------------------------------------------------------------------
+// BEGIN/END SMALL MULTIPLES
+//-----------------------------------------------------------------------------
+
+bool BeginSmallMultiples(const char* title_id, int rows, int cols, const ImVec2& size, ImPlotFlags plot_flags, ImPlotAxisFlags x_flags, ImPlotAxisFlags y_flags) {
+    const ImPlotSubplotFlags flags = ImPlotSubplotFlags_NoResize | ImPlotSubplotFlags_NoAlign | ImPlotSubplotFlags_NoMenus | ImPlotSubplotFlags_NoLegend;
+    if (!BeginSubplots(title_id, rows, cols, size, flags))
+        return false;
+    ImPlotContext& gp      = *GImPlot;
+    ImPlotSubplot& subplot = *gp.CurrentSubplot;
+    subplot.Batched        = true;
+    subplot.BatchPlotFlags = plot_flags;
+    subplot.BatchXFlags    = x_flags;
+    subplot.BatchYFlags    = y_flags;
+    return true;
+}
+
+void EndSmallMultiples() {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentSubplot != nullptr && gp.CurrentSubplot->Batched, "Mismatched BeginSmallMultiples()/EndSmallMultiples()!");
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "Mismatched BeginSmallMultiple()/EndSmallMultiple()!");
+    gp.CurrentSubplot->Batched = false;
+    EndSubplots();
+}
+
+bool BeginSmallMultiple() {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentSubplot != nullptr && gp.CurrentSubplot->Batched, "BeginSmallMultiple() needs to be called between BeginSmallMultiples() and EndSmallMultiples()!");
+    ImPlotSubplot& subplot = *gp.CurrentSubplot;
+    if (subplot.CurrentIdx >= subplot.Rows * subplot.Cols)
+        return false;
+    // skip cells that are scrolled out of view without touching their plot state
+    ImGuiWindow* Window = GImGui->CurrentWindow;
+    const ImRect cell_rect(Window->DC.CursorPos, Window->DC.CursorPos + subplot.CellSize);
+    if (!Window->ClipRect.Overlaps(cell_rect)) {
+        SubplotNextCell();
+        return false;
+    }
+    if (!BeginPlot("", ImVec2(0,0), subplot.BatchPlotFlags))
+        return false;
+    SetupAxes(nullptr, nullptr, subplot.BatchXFlags, subplot.BatchYFlags);
+    return true;
+}
+
+void EndSmallMultiple() {
+    EndPlot();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
 //-----------------------------------------------------------------------------
@@ -3826,6 +4587,17 @@ bool IsSubplotsHovered() {
     return gp.CurrentSubplot->FrameHovered;
 }
 
+ImPlotChangeFlags GetPlotChanges(const char* title_id) {
+    ImPlotPlot* plot = GetPlot(title_id);
+    return plot != nullptr ? plot->Changes : ImPlotChangeFlags_None;
+}
+
+bool IsPlotChanging(ImPlotChangeFlags flags) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "IsPlotChanging() needs to be called after EndPlot()!");
+    return (gp.LastPlotChanges & flags) != 0;
+}
+
 bool IsPlotSelected() {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "IsPlotSelected() needs to be called between BeginPlot() and EndPlot()!");
@@ -4947,6 +5719,24 @@ void PopPlotClipRect() {
     ImGui::PopClipRect();
 }
 
+void SetStatsEnabled(bool enabled) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "SetStatsEnabled() cannot be called between BeginPlot() and EndPlot()!");
+    gp.StatsEnabled = enabled;
+}
+
+bool IsStatsEnabled() {
+    return GImPlot->StatsEnabled;
+}
+
+bool GetPlotStats(const char* title_id, ImPlotPlotStats* stats) {
+    ImPlotPlot* plot = GetPlot(title_id);
+    if (plot == nullptr)
+        return false;
+    *stats = plot->Stats;
+    return true;
+}
+
 static void HelpMarker(const char* desc) {
     ImGui::TextDisabled("(?)");
     if (ImGui::IsItemHovered()) {
@@ -5305,6 +6095,25 @@ void ShowAxisMetrics(const ImPlotPlot& plot, const ImPlotAxis& axis) {
     }
 }
 
+static void ShowItemStats(const ImPlotItemStats& stats) {
+    ImGui::BulletText("Time: %.1f us (%.1f us fitting)", stats.Time, stats.FitTime);
+    ImGui::BulletText("Prims: %lld (%lld culled)", (long long)stats.Prims, (long long)stats.PrimsCulled);
+    ImGui::BulletText("Vertices: %d, Indices: %d", stats.VtxCount, stats.IdxCount);
+}
+
+static void ShowPlotStats(const ImPlotPlotStats& stats) {
+    ImGui::BulletText("Time: %.1f us (%.1f setup, %.1f items, %.1f end)", stats.Time, stats.SetupTime, stats.ItemTime, stats.EndTime);
+    ImGui::BulletText("Items: %d (%.1f us fitting)", stats.ItemCount, stats.FitTime);
+    ImGui::BulletText("Prims: %lld (%lld culled)", (long long)stats.Prims, (long long)stats.PrimsCulled);
+    ImGui::BulletText("Vertices: %d, Indices: %d", stats.VtxCount, stats.IdxCount);
+}
+
+static int IMGUI_CDECL PlotStatsTimeComp(const void* _a, const void* _b) {
+    const ImPlotPlot* a = *(const ImPlotPlot* const*)_a;
+    const ImPlotPlot* b = *(const ImPlotPlot* const*)_b;
+    return a->Stats.Time < b->Stats.Time ? 1 : a->Stats.Time > b->Stats.Time ? -1 : 0;
+}
+
 void ShowMetricsWindow(bool* p_popen) {
 
     static bool show_plot_rects = false;
@@ -5325,6 +6134,9 @@ void ShowMetricsWindow(bool* p_popen) {
     ImGui::Text("ImPlot " IMPLOT_VERSION);
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("Mouse Position: [%.0f,%.0f]", io.MousePos.x, io.MousePos.y);
+    ImGui::Text("Tickers: %d located, %d shared", gp.TickerCache.Keys.Size, gp.TickerCache.Hits);
+    ImGui::Text("Frame Arena: %d bytes used, %d capacity, %d high-water", (int)gp.FrameArena.Used, (int)gp.FrameArena.Capacity, (int)gp.FrameArena.HighWater);
+    ImGui::Checkbox("Record Stats", &gp.StatsEnabled);
     ImGui::Separator();
     if (ImGui::TreeNode("Tools")) {
         if (ImGui::Button("Bust Plot Cache"))
@@ -5377,6 +6189,25 @@ void ShowMetricsWindow(bool* p_popen) {
             fg.AddRect(subplot->Items.Legend.RectClamped.Min, subplot->Items.Legend.RectClamped.Max, IM_COL32(255,128,0,255));
         }
     }
+    if (gp.StatsEnabled && ImGui::TreeNode("Stats")) {
+        // most expensive plots first
+        ImVector<ImPlotPlot*> sorted;
+        sorted.resize(n_plots);
+        for (int p = 0; p < n_plots; ++p)
+            sorted[p] = gp.Plots.GetByIndex(p);
+        if (n_plots > 1)
+            ImQsort(sorted.Data, (size_t)n_plots, sizeof(ImPlotPlot*), PlotStatsTimeComp);
+        for (int p = 0; p < n_plots; ++p) {
+            const ImPlotPlot& plot = *sorted[p];
+            ImGui::PushID(p);
+            if (ImGui::TreeNode("Plot", "%8.1f us  %s [0x%08X]", plot.Stats.Time, plot.HasTitle() ? plot.GetTitle() : "", plot.ID)) {
+                ShowPlotStats(plot.Stats);
+                ImGui::TreePop();
+            }
+            ImGui::PopID();
+        }
+        ImGui::TreePop();
+    }
     if (ImGui::TreeNode("Plots","Plots (%d)", n_plots)) {
         for (int p = 0; p < n_plots; ++p) {
             // plot
@@ -5398,12 +6229,20 @@ void ShowMetricsWindow(bool* p_popen) {
                             ImGui::BulletText("NameOffset: %d",item->NameOffset);
                             ImGui::BulletText("Name: %s", item->NameOffset != -1 ? plot.Items.Legend.Labels.Buf.Data + item->NameOffset : "N/A");
                             ImGui::BulletText("Hovered: %s",item->LegendHovered ? "true" : "false");
+                            if (gp.StatsEnabled && ImGui::TreeNode("Stats")) {
+                                ShowItemStats(item->Stats);
+                                ImGui::TreePop();
+                            }
                             ImGui::TreePop();
                         }
                         ImGui::PopID();
                     }
                     ImGui::TreePop();
                 }
+                if (gp.StatsEnabled && ImGui::TreeNode("Stats")) {
+                    ShowPlotStats(plot.Stats);
+                    ImGui::TreePop();
+                }
                 char buff[16];
                 for (int i = 0; i < IMPLOT_NUM_X_AXES; ++i) {
                     ImFormatString(buff,16,"X-Axis %d", i+1);
@@ -5456,6 +6295,10 @@ void ShowMetricsWindow(bool* p_popen) {
                             ImGui::BulletText("NameOffset: %d",item->NameOffset);
                             ImGui::BulletText("Name: %s", item->NameOffset != -1 ? plot.Items.Legend.Labels.Buf.Data + item->NameOffset : "N/A");
                             ImGui::BulletText("Hovered: %s",item->LegendHovered ? "true" : "false");
+                            if (gp.StatsEnabled && ImGui::TreeNode("Stats")) {
+                                ShowItemStats(item->Stats);
+                                ImGui::TreePop();
+                            }
                             ImGui::TreePop();
                         }
                         ImGui::PopID();
@@ -5932,4 +6775,112 @@ void StyleColorsLight(ImPlotStyle* dst) {
 
 }  // namespace ImPlot
 
+//-----------------------------------------------------------------------------
+// [SECTION] Platform
+//-----------------------------------------------------------------------------
+
+// Platform headers are included last, so that their macros (e.g. min/max on Windows) cannot affect the code above.
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static void ImPlotThreadYield() {
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+#ifdef _WIN32
+static double ImPlotPerformanceTicksPerUs() {
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return (double)frequency.QuadPart * 1e-6;
+}
+#endif
+
+// Monotonic time in microseconds, used for cost statistics
+double ImPlot::GetStatsTime() {
+#ifdef _WIN32
+    static const double ticks_per_us = ImPlotPerformanceTicksPerUs();
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart / ticks_per_us;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e6 + (double)ts.tv_nsec * 1e-3;
+#endif
+}
+
+bool ImPlotMappedFile::Open(const char* filename) {
+    Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        return false;
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        return false;
+    }
+    Data   = data;
+    Size   = (size_t)size.QuadPart;
+    Handle = mapping;
+#else
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // the mapping keeps its own reference to the file
+    close(fd);
+    if (data == MAP_FAILED)
+        return false;
+    Data = data;
+    Size = (size_t)st.st_size;
+#endif
+    return true;
+}
+
+void ImPlotMappedFile::Close() {
+    if (Data == nullptr)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(Data);
+    CloseHandle((HANDLE)Handle);
+#else
+    munmap(const_cast<void*>(Data), Size);
+#endif
+    Data   = nullptr;
+    Size   = 0;
+    Handle = nullptr;
+}
+
 #endif // #ifndef IMGUI_DISABLE
@@ -61,6 +61,13 @@
 #define IMPLOT_API
 #endif
 
+// Define the storage class of the current context pointer GImPlot (e.g. as thread_local in imconfig.h) so that each
+// thread can drive its own ImGui and ImPlot contexts concurrently, e.g. to render offscreen charts on several cores.
+// GImGui must then be thread-local as well (see imgui.cpp). MSVC cannot export thread-local data from a DLL.
+#ifndef IMPLOT_THREAD_LOCAL
+#define IMPLOT_THREAD_LOCAL
+#endif
+
 // ImPlot version string.
 #define IMPLOT_VERSION "1.1 WIP"
 // ImPlot version integer encoded as XYYZZ (X=major, YY=minor, ZZ=patch).
@@ -79,6 +86,10 @@ constexpr ImVec4 IMPLOT_AUTO_COL = ImVec4(0,0,0,-1);
 
 // Forward declarations
 struct ImPlotContext;             // ImPlot context (opaque struct, see implot_internal.h)
+struct ImPlotStreamBuffer;        // Lock-free streaming series (see below)
+struct ImPlotDecimatedSeries;     // Append-only series with a min/max pyramid (see below)
+struct ImPlotMappedFile;          // Read-only memory mapped file (see below)
+struct ImPlotAsyncSeries;         // Series decimated on a worker thread (see below)
 
 // Enums/Flags
 typedef int ImAxis;                   // -> enum ImAxis_
@@ -90,6 +101,7 @@ typedef int ImPlotLegendFlags;        // -> enum ImPlotLegendFlags_
 typedef int ImPlotMouseTextFlags;     // -> enum ImPlotMouseTextFlags_
 typedef int ImPlotDragToolFlags;      // -> ImPlotDragToolFlags_
 typedef int ImPlotColormapScaleFlags; // -> ImPlotColormapScaleFlags_
+typedef int ImPlotChangeFlags;        // -> ImPlotChangeFlags_
 
 typedef int ImPlotItemFlags;          // -> ImPlotItemFlags_
 typedef int ImPlotLineFlags;          // -> ImPlotLineFlags_
@@ -153,7 +165,8 @@ enum ImPlotProp_ {
     ImPlotProp_Size,            // size of error bar whiskers (width or height), and digital bars (height) *in pixels*
     ImPlotProp_Offset,          // data index offset
     ImPlotProp_Stride,          // data stride in bytes; IMPLOT_AUTO will result in sizeof(T) where T is the type passed to PlotX
-    ImPlotProp_Flags            // optional item flags; can be composed from common ImPlotItemFlags and/or specialized ImPlotXFlags
+    ImPlotProp_Flags,           // optional item flags; can be composed from common ImPlotItemFlags and/or specialized ImPlotXFlags
+    ImPlotProp_ItemID           // optional precomputed item ID (see GetItemID); if 0, the ID is computed by hashing label_id
 };
 
 // Options for plots (see BeginPlot).
@@ -168,6 +181,7 @@ enum ImPlotFlags_ {
     ImPlotFlags_NoFrame       = 1 << 6,  // the ImGui frame will not be rendered
     ImPlotFlags_Equal         = 1 << 7,  // x and y axes pairs will be constrained to have the same units/pixel
     ImPlotFlags_Crosshairs    = 1 << 8,  // the default mouse cursor will be replaced with a crosshair when hovered
+    ImPlotFlags_Retained      = 1 << 9,  // while idle and its content hash is unchanged, the plot's last draw output is replayed and BeginPlot returns false (see SetNextPlotContentHash)
     ImPlotFlags_CanvasOnly    = ImPlotFlags_NoTitle | ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoBoxSelect | ImPlotFlags_NoMouseText
 };
 
@@ -232,6 +246,17 @@ enum ImPlotMouseTextFlags_ {
     ImPlotMouseTextFlags_ShowAlways  = 1 << 2, // always display mouse position even if plot not hovered
 };
 
+// Changes detected in a plot between frames (see GetPlotChanges)
+enum ImPlotChangeFlags_ {
+    ImPlotChangeFlags_None      = 0,      // nothing changed
+    ImPlotChangeFlags_Limits    = 1 << 0, // the range of an axis changed, or an axis was enabled/disabled
+    ImPlotChangeFlags_Size      = 1 << 1, // the plot frame or plot area moved or was resized
+    ImPlotChangeFlags_Items     = 1 << 2, // items were added or removed, shown or hidden, or changed color or marker
+    ImPlotChangeFlags_Hover     = 1 << 3, // the plot, an axis, the legend or a legend entry changed hover state, or the mouse moved over the plot
+    ImPlotChangeFlags_Selection = 1 << 4, // a box selection began, changed, or ended
+    ImPlotChangeFlags_All       = ImPlotChangeFlags_Limits | ImPlotChangeFlags_Size | ImPlotChangeFlags_Items | ImPlotChangeFlags_Hover | ImPlotChangeFlags_Selection
+};
+
 // Options for DragPoint, DragLine, DragRect
 enum ImPlotDragToolFlags_ {
     ImPlotDragToolFlags_None      = 0,      // default
@@ -530,6 +555,7 @@ struct ImPlotSpec {
     int             Offset          = 0;                     // data index offset
     int             Stride          = IMPLOT_AUTO;           // data stride in bytes; IMPLOT_AUTO will result in sizeof(T) where T is the type passed to PlotX
     ImPlotItemFlags Flags           = ImPlotItemFlags_None;  // optional item flags; can be composed from common ImPlotItemFlags and/or specialized ImPlotXFlags
+    ImGuiID         ItemID          = 0;                     // optional precomputed item ID (see GetItemID); if 0, the ID is computed by hashing label_id
 
     ImPlotSpec() { }
 
@@ -564,6 +590,7 @@ struct ImPlotSpec {
         case ImPlotProp_Offset          : Offset          = (int)v;                                   return;
         case ImPlotProp_Stride          : Stride          = (int)v;                                   return;
         case ImPlotProp_Flags           : Flags           = (ImPlotItemFlags)v;                       return;
+        case ImPlotProp_ItemID          : ItemID          = (ImGuiID)v;                               return;
         default: break;
         }
         IM_ASSERT(0 && "User provided an ImPlotProp which cannot be set from scalar value!");
@@ -603,6 +630,13 @@ struct ImPlotSpec {
     }
 };
 
+// IEEE 754 half precision (binary16) sample stored as its raw bits. Accepted by PlotLineScaled and PlotScatterScaled.
+struct ImPlotHalf {
+    ImU16 Bits;
+    constexpr ImPlotHalf()                    : Bits(0) { }
+    constexpr explicit ImPlotHalf(ImU16 bits) : Bits(bits) { }
+};
+
 // Double precision version of ImVec2 used by ImPlot. Extensible by end users.
 IM_MSVC_RUNTIME_CHECKS_OFF
 struct ImPlotPoint {
@@ -710,6 +744,126 @@ struct ImPlotInputMap {
     IMPLOT_API ImPlotInputMap();
 };
 
+// Cost statistics of a plot item, recorded when stats are enabled (see SetStatsEnabled). Times are in microseconds.
+struct ImPlotItemStats {
+    double Time;        // time spent between BeginItem and EndItem (i.e. the bulk of a PlotX call)
+    double FitTime;     // portion of Time spent fitting the item's data to the axes
+    ImS64  Prims;       // number of primitives (line segments, markers, rects, etc.) submitted for rendering
+    ImS64  PrimsCulled; // number of submitted primitives culled because they fell outside of the plot area
+    int    VtxCount;    // number of vertices added to the plot draw list
+    int    IdxCount;    // number of indices added to the plot draw list
+    ImPlotItemStats() { Time = FitTime = 0; Prims = PrimsCulled = VtxCount = IdxCount = 0; }
+};
+
+// Cost statistics of a plot, recorded when stats are enabled (see SetStatsEnabled). Times are in microseconds.
+struct ImPlotPlotStats {
+    double Time;        // time from BeginPlot to the end of EndPlot, including user code in between
+    double SetupTime;   // time spent in SetupFinish (axes constraints, tick location and layout)
+    double EndTime;     // time spent in EndPlot (input handling, axes, legend and annotation rendering)
+    double ItemTime;    // sum of the Time of all items plotted
+    double FitTime;     // sum of the FitTime of all items plotted
+    int    ItemCount;   // number of items plotted (hidden items are not counted)
+    ImS64  Prims;       // sum of the Prims of all items plotted
+    ImS64  PrimsCulled; // sum of the PrimsCulled of all items plotted
+    int    VtxCount;    // sum of the VtxCount of all items plotted
+    int    IdxCount;    // sum of the IdxCount of all items plotted
+    ImPlotPlotStats() { Time = SetupTime = EndTime = ItemTime = FitTime = 0; ItemCount = Prims = PrimsCulled = VtxCount = IdxCount = 0; }
+};
+
+// Streaming series for realtime plots, written by one producer thread (e.g. an acquisition thread) and plotted by one
+// consumer thread (the UI thread) without either ever blocking. Push() enqueues samples into a lock-free SPSC queue;
+// Update() moves them into a rolling history of the last #capacity samples, stored as separate arrays of doubles.
+// Pass the buffer directly to PlotLine/PlotScatter, which read the wrapped history as two linear runs.
+//
+// Example:
+//
+//   static ImPlotStreamBuffer stream(10000);
+//   // acquisition thread
+//   stream.Push(t, value);
+//   // UI thread
+//   stream.Update();
+//   if (ImPlot::BeginPlot("Stream")) {
+//       ImPlot::PlotLine("Signal", stream);
+//       ImPlot::EndPlot();
+//   }
+struct ImPlotStreamBuffer {
+    // History (consumer thread only)
+    double*                   Xs;            // x values of the history, the oldest of which is at Offset()
+    double*                   Ys;            // y values of the history, the oldest of which is at Offset()
+    int                       Capacity;      // number of samples kept in the history
+    int                       Count;         // number of samples currently in the history
+    int                       Next;          // index of the next history slot to be written
+    // Queue (shared)
+    double*                   QueueXs;
+    double*                   QueueYs;
+    unsigned int              QueueMask;     // queue capacity - 1 (the capacity is a power of two)
+    unsigned int              QueueHead;     // samples pushed, written by the producer only (accessed atomically)
+    unsigned int              QueueTail;     // samples consumed, written by the consumer only (accessed atomically)
+    unsigned int              Dropped;       // samples dropped by Push because the queue was full (accessed atomically)
+
+    // #queue_capacity is the number of samples that can be pushed between calls to Update (defaults to #capacity)
+    IMPLOT_API ImPlotStreamBuffer(int capacity = 2000, int queue_capacity = 0);
+    IMPLOT_API ~ImPlotStreamBuffer();
+    ImPlotStreamBuffer(const ImPlotStreamBuffer&) = delete;
+    ImPlotStreamBuffer& operator=(const ImPlotStreamBuffer&) = delete;
+
+    // Producer: enqueues a sample. Never blocks; returns false and drops the sample if the queue is full.
+    IMPLOT_API bool Push(double x, double y);
+    // Consumer: moves all queued samples into the history and returns how many were moved. Call once per frame before plotting.
+    IMPLOT_API int  Update();
+    // Consumer: empties the history (queued samples are kept).
+    void            Clear()        { Count = Next = 0; }
+    // Consumer: number of samples in the history.
+    int             Size()   const { return Count; }
+    // Consumer: index of the oldest sample in Xs/Ys.
+    int             Offset() const { return Count < Capacity ? 0 : Next; }
+};
+
+// Min/max summary of a run of consecutive samples in an ImPlotDecimatedSeries.
+struct ImPlotMinMaxBin {
+    double X0, X1;     // x of the first and last sample in the run
+    double YMin, YMax; // extrema of y in the run
+    bool   MinFirst;   // true if YMin occurs before YMax
+};
+
+// Append-only series for long captures that are viewed at any zoom level. Alongside the raw samples, it maintains a
+// pyramid of min/max bins that is updated incrementally by Append(): bins of level k summarize 4^(k+1) samples. When
+// passed to PlotLine, the coarsest level that still gives ~2 points per pixel over the visible x range is rendered,
+// so each frame costs O(pixels) regardless of the length of the series. X values must be non-decreasing.
+struct ImPlotDecimatedSeries {
+    static const int LevelCount  = 15;
+    static const int LevelFactor = 4;
+    ImVector<double>          Xs;                 // raw x values
+    ImVector<double>          Ys;                 // raw y values
+    ImVector<ImPlotMinMaxBin> Levels[LevelCount]; // min/max bins of each pyramid level
+
+    // Appends a sample and updates one bin per pyramid level. #x must be >= the last appended x.
+    IMPLOT_API void Append(double x, double y);
+    // Removes all samples.
+    IMPLOT_API void Clear();
+    // Number of raw samples.
+    int             Size() const { return Xs.Size; }
+};
+
+// Read-only memory mapping of a file (mmap on POSIX, a file mapping on Windows), used to plot binary captures that are
+// too large to load into memory with PlotLineMapped. Pages are only read from disk when they are first touched.
+struct ImPlotMappedFile {
+    const void* Data;   // start of the mapping, or nullptr if no file is open
+    size_t      Size;   // size of the mapping in bytes
+    void*       Handle; // platform mapping handle (Windows only)
+
+    ImPlotMappedFile() { Data = nullptr; Size = 0; Handle = nullptr; }
+    ~ImPlotMappedFile() { Close(); }
+    ImPlotMappedFile(const ImPlotMappedFile&) = delete;
+    ImPlotMappedFile& operator=(const ImPlotMappedFile&) = delete;
+
+    // Maps the whole file at #filename, closing any previously open file. Returns false on failure or if the file is empty.
+    IMPLOT_API bool Open(const char* filename);
+    // Unmaps the file.
+    IMPLOT_API void Close();
+    bool            IsOpen() const { return Data != nullptr; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Callbacks
 //-----------------------------------------------------------------------------
@@ -723,6 +877,77 @@ typedef ImPlotPoint (*ImPlotGetter)(int idx, void* user_data);
 // Callback signature for axis transform.
 typedef double (*ImPlotTransform)(double value, void* user_data);
 
+// Callback signature for scheduling a job of an ImPlotAsyncSeries: call job(job_data) once, from any thread.
+typedef void (*ImPlotAsyncTask)(void (*job)(void* job_data), void* job_data, void* user_data);
+
+// Axis state an ImPlotAsyncSeries job maps data with. Values are transformed like the axis, then scaled so that
+// ScaleMin lands on pixel 0 and ScaleMax on pixel Pixels (the signed extent of the axis in pixels).
+struct ImPlotAsyncAxis {
+    double          Min, Max;           // plot range of the axis
+    double          ScaleMin, ScaleMax; // plot range in scale space (i.e. after Transform)
+    float           Pixels;             // PixelMax - PixelMin of the axis
+    ImPlotTransform Transform;          // forward transform of the axis, or nullptr if linear
+    void*           TransformData;
+};
+
+// Series whose decimation, fitting and transformation to pixels run on a worker thread instead of inside PlotLine.
+// Submit() copies a snapshot of the data (x values must be sorted). When passed to PlotLine, a job is handed to the
+// #task callback whenever the snapshot or the x axis changed and no job is running; the job reduces the visible samples
+// to at most four pixel-space points per pixel column (first, min, max and last). PlotLine always renders the last
+// completed points, remapped to the current axes, so an expensive series never stalls the frame and lags at most one
+// job behind. The points are allocated on the UI thread, so jobs never call into ImGui. Shaded fills and markers are
+// not rendered. The destructor waits for a running job; if the task callback drops a job without running it (e.g. a
+// pool shutting down), call Abandon() for it, otherwise the destructor would wait forever. See ShowDemoWindow.
+//
+// Example:
+//
+//   static void MyTask(void (*job)(void*), void* job_data, void*) { MyThreadPool.Enqueue(job, job_data); }
+//   static ImPlotAsyncSeries series(MyTask);
+//   if (data_changed)
+//       series.Submit(xs, ys, count);
+//   if (ImPlot::BeginPlot("Async")) {
+//       ImPlot::PlotLine("Signal", series);
+//       ImPlot::EndPlot();
+//   }
+struct ImPlotAsyncSeries {
+    enum { State_Idle, State_Running, State_Done };
+    // Snapshot (UI thread)
+    ImVector<double> StagedXs, StagedYs; // data submitted since the last job started
+    bool             Staged;             // true if StagedXs/StagedYs have not been handed to a job yet
+    // Job (owned by the worker while State is State_Running)
+    ImVector<double> JobXs, JobYs;       // data of the last job
+    ImPlotAsyncAxis  JobX, JobY;         // axes of the last job
+    ImVector<ImVec2> JobPoints;          // output of the last job
+    ImPlotRect       JobBounds;          // data extents of the last job
+    // Result (UI thread)
+    ImVector<ImVec2> Points;             // pixel-space points, relative to the pixel origin of ResultX/ResultY
+    ImPlotAsyncAxis  ResultX, ResultY;   // axes Points were computed for
+    ImPlotRect       Bounds;             // data extents Points were computed from, used for fitting
+    bool             HasResult;
+    int              State;              // State_ of the last job (accessed atomically)
+    ImPlotAsyncTask  Task;
+    void*            TaskData;
+
+    IMPLOT_API ImPlotAsyncSeries(ImPlotAsyncTask task, void* task_data = nullptr);
+    // Waits for a running job to finish (see Abandon).
+    IMPLOT_API ~ImPlotAsyncSeries();
+    ImPlotAsyncSeries(const ImPlotAsyncSeries&) = delete;
+    ImPlotAsyncSeries& operator=(const ImPlotAsyncSeries&) = delete;
+
+    // Copies #count samples to be processed by the next job. Never waits for a running job.
+    IMPLOT_API void Submit(const double* xs, const double* ys, int count);
+    // Collects a completed job, then starts a new one if the data or the x axis changed. Returns true if a job completed.
+    // Called by PlotLine; the y axis only needs a new job if its transform changed, since remapping y is exact.
+    IMPLOT_API bool Update(const ImPlotAsyncAxis& x_axis, const ImPlotAsyncAxis& y_axis);
+    // True while a job is running.
+    IMPLOT_API bool Busy() const;
+    // Marks a running job as never going to run, e.g. when the task callback dropped it. Only call this once you know
+    // the job will not start, since the series may then be destroyed or start a new job over the same buffers.
+    IMPLOT_API void Abandon();
+    // Job entry point handed to #Task.
+    IMPLOT_API static void Run(void* series);
+};
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -735,7 +960,7 @@ IMPLOT_API ImPlotContext* CreateContext();
 IMPLOT_API void DestroyContext(ImPlotContext* ctx = nullptr);
 // Returns the current ImPlot context. nullptr if no context has ben set.
 IMPLOT_API ImPlotContext* GetCurrentContext();
-// Sets the current ImPlot context.
+// Sets the current ImPlot context (of the calling thread if IMPLOT_THREAD_LOCAL is defined as thread_local).
 IMPLOT_API void SetCurrentContext(ImPlotContext* ctx);
 
 // Sets the current **ImGui** context. This is ONLY necessary if you are compiling
@@ -832,6 +1057,51 @@ IMPLOT_API bool BeginSubplots(const char* title_id,
 // of an if statement conditioned on BeginSubplots(). See example above.
 IMPLOT_API void EndSubplots();
 
+//-----------------------------------------------------------------------------
+// [SECTION] Begin/End Small Multiples
+//-----------------------------------------------------------------------------
+
+// Starts a grid of many small, similar plots (e.g. sparklines) that share one plot and axis
+// configuration. If the function returns true, EndSmallMultiples() MUST be called! Call
+// BeginSmallMultiple/EndSmallMultiple AT MOST [rows*cols] times in between.
+//
+// Example:
+//
+// if (BeginSmallMultiples("##Sparks",16,16,ImVec2(-1,800))) {
+//     for (int i = 0; i < 256; ++i) {
+//         if (BeginSmallMultiple()) {
+//             ImPlot::PlotLine("##Data",data[i],count);
+//             EndSmallMultiple();
+//         }
+//     }
+//     EndSmallMultiples();
+// }
+//
+// Important notes:
+//
+// - Small multiples are a subplot grid without splitters, alignment, menus or a shared legend.
+// - Cells outside of the window's clip rect are skipped entirely (BeginSmallMultiple returns false).
+// - Only the hovered (or actively dragged) cell processes mouse input.
+// - Each cell is clipped to its own plot area, like any other plot.
+IMPLOT_API bool BeginSmallMultiples(const char* title_id,
+                                    int rows,
+                                    int cols,
+                                    const ImVec2& size,
+                                    ImPlotFlags plot_flags   = ImPlotFlags_CanvasOnly,
+                                    ImPlotAxisFlags x_flags  = ImPlotAxisFlags_NoDecorations | ImPlotAxisFlags_AutoFit,
+                                    ImPlotAxisFlags y_flags  = ImPlotAxisFlags_NoDecorations | ImPlotAxisFlags_AutoFit);
+
+// Only call EndSmallMultiples() if BeginSmallMultiples() returns true!
+IMPLOT_API void EndSmallMultiples();
+
+// Begins the next cell of a small multiples grid. The cell's axes are already set up with the
+// flags passed to BeginSmallMultiples, but further Setup calls may still be made (e.g. limits).
+// Only call EndSmallMultiple() if BeginSmallMultiple() returns true!
+IMPLOT_API bool BeginSmallMultiple();
+
+// Ends the current cell of a small multiples grid.
+IMPLOT_API void EndSmallMultiple();
+
 //-----------------------------------------------------------------------------
 // [SECTION] Setup
 //-----------------------------------------------------------------------------
@@ -933,6 +1203,10 @@ IMPLOT_API void SetNextAxesLimits(double x_min, double x_max, double y_min, doub
 // Sets all upcoming axes to auto fit to their data.
 IMPLOT_API void SetNextAxesToFit();
 
+// Sets the content hash (or version) of the upcoming plot, used by ImPlotFlags_Retained. It must change whenever anything
+// submitted between BeginPlot and EndPlot changes (data, Setup calls, item specs, etc.). Plots without a hash are never retained.
+IMPLOT_API void SetNextPlotContentHash(ImGuiID hash);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Items
 //-----------------------------------------------------------------------------
@@ -984,16 +1258,69 @@ IMPLOT_API void SetNextAxesToFit();
 //
 // NB: All types are converted to double before plotting. You may lose information
 // if you try plotting extremely large 64-bit integral types. Proceed with caution!
+//
+// NB: PlotLine64, PlotScatter64, PlotStairs64 and PlotShaded64 take an ImS64 #count for series of more than INT_MAX
+// samples (e.g. multi-billion-sample captures in an ImPlotMappedFile). They have distinct names so that existing calls
+// with unsigned, long or 64-bit counts keep resolving to the int overloads. Every sample is still visited each frame,
+// so series that large should be reduced beforehand (see ImPlotDecimatedSeries and PlotLineMapped). Counts above
+// INT_MAX are not exercised by the demo or benchmark.
 
 // Plots a standard 2D line plot.
 IMPLOT_TMP void PlotLine(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotLine64(const char* label_id, const T* values, ImS64 count, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotLine64(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_API void PlotLineG(const char* label_id, ImPlotGetter getter, void* data, int count, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_API void PlotLine(const char* label_id, const ImPlotStreamBuffer& buffer, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_API void PlotLine(const char* label_id, const ImPlotDecimatedSeries& series, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_API void PlotLine(const char* label_id, ImPlotAsyncSeries& series, const ImPlotSpec& spec=ImPlotSpec());
+
+// Plots #series lines sharing the same #count x values, e.g. many channels against one timestamp array. Each series is
+// an item labeled #label_ids[s] whose y values are #ys[s], or ys[i * series + s] for an interleaved matrix (if set,
+// ImPlotSpec::Stride is the record size of both xs and the matrix). The shared x values are transformed to pixels once
+// for all series. Markers, LineColors and the Segments, Loop, Shaded and SkipNaN flags fall back to one PlotLine per series.
+IMPLOT_TMP void PlotLines(const char* const label_ids[], const T* xs, const T* const ys[], int series, int count, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotLines(const char* const label_ids[], const T* xs, const T* ys, int series, int count, const ImPlotSpec& spec=ImPlotSpec());
+
+// Plots a line of raw samples decoded as #scale*v+#bias, e.g. int16 ADC counts with a per-channel gain and bias,
+// without converting the buffer first. The xs/ys form only decodes ys. ImPlotSpec::Offset still rotates the sample
+// index as usual. Also instantiated for ImPlotHalf samples.
+IMPLOT_TMP void PlotLineScaled(const char* label_id, const T* values, int count, double scale, double bias, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotLineScaled(const char* label_id, const T* xs, const T* ys, int count, double scale, double bias, const ImPlotSpec& spec=ImPlotSpec());
+
+// Plots fields #x and #y of #count records of type R, e.g. PlotLine("Pos", particles, &Particle::X, &Particle::Y, n).
+// The fields are addressed through pointers to members and each sample is a direct typed load, without the offset/stride
+// dispatch of ImPlotSpec::Offset and ImPlotSpec::Stride (both are ignored). F must be a numeric type ImPlot is instantiated for.
+// PlotLineRecords is the underlying entry point, taking the first x and y and the record size in bytes.
+IMPLOT_TMP void PlotLineRecords(const char* label_id, const T* xs, const T* ys, int count, int record_size, const ImPlotSpec& spec=ImPlotSpec());
+template <typename R, typename F>
+inline void PlotLine(const char* label_id, const R* records, F R::*x, F R::*y, int count, const ImPlotSpec& spec=ImPlotSpec()) {
+    PlotLineRecords<F>(label_id, records ? &(records->*x) : nullptr, records ? &(records->*y) : nullptr, count, (int)sizeof(R), spec);
+}
+
+// Plots #count fixed-layout records of a memory mapped file as a line. The x and y fields of type T of the first record
+// are at byte #x_offset and #y_offset, and ImPlotSpec::Stride is the record size in bytes (e.g. PlotLineMapped<float>(
+// "ch0", file, n, 0, 4, {ImPlotProp_Stride, 8}) for interleaved float pairs). X values must be sorted: only the records
+// in the visible x range are read, so only their pages are faulted in. When fitting, x is fit to the first and last
+// records and y to the visible records, or to an evenly spaced subset of all records if x is being fit as well.
+IMPLOT_TMP void PlotLineMapped(const char* label_id, const ImPlotMappedFile& file, ImS64 count, size_t x_offset, size_t y_offset, const ImPlotSpec& spec=ImPlotSpec());
 
 // Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle.
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotScatter64(const char* label_id, const T* values, ImS64 count, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotScatter64(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_API void PlotScatterG(const char* label_id, ImPlotGetter getter, void* data, int count, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_API void PlotScatter(const char* label_id, const ImPlotStreamBuffer& buffer, const ImPlotSpec& spec=ImPlotSpec());
+// Plots raw samples decoded as #scale*v+#bias (see PlotLineScaled).
+IMPLOT_TMP void PlotScatterScaled(const char* label_id, const T* values, int count, double scale, double bias, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotScatterScaled(const char* label_id, const T* xs, const T* ys, int count, double scale, double bias, const ImPlotSpec& spec=ImPlotSpec());
+// Plots fields #x and #y of #count records of type R with direct typed loads (see PlotLineRecords).
+IMPLOT_TMP void PlotScatterRecords(const char* label_id, const T* xs, const T* ys, int count, int record_size, const ImPlotSpec& spec=ImPlotSpec());
+template <typename R, typename F>
+inline void PlotScatter(const char* label_id, const R* records, F R::*x, F R::*y, int count, const ImPlotSpec& spec=ImPlotSpec()) {
+    PlotScatterRecords<F>(label_id, records ? &(records->*x) : nullptr, records ? &(records->*y) : nullptr, count, (int)sizeof(R), spec);
+}
 
 // Plots a bubble graph. #szs are the radius of each bubble in plot units.
 IMPLOT_TMP void PlotBubbles(const char* label_id, const T* values, const T* szs, int count, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
@@ -1004,13 +1331,18 @@ IMPLOT_TMP void PlotPolygon(const char* label_id, const T* xs, const T* ys, int
 
 // Plots a a stairstep graph. The y value is continued constantly to the right from every x position, i.e. the interval [x[i], x[i+1]) has the value y[i]
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotStairs64(const char* label_id, const T* values, ImS64 count, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotStairs64(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_API void PlotStairsG(const char* label_id, ImPlotGetter getter, void* data, int count, const ImPlotSpec& spec=ImPlotSpec());
 
 // Plots a shaded (filled) region between two lines, or a line and a horizontal reference. Set yref to +/-INFINITY for infinite fill extents.
 IMPLOT_TMP void PlotShaded(const char* label_id, const T* values, int count, double yref=0, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotShaded64(const char* label_id, const T* values, ImS64 count, double yref=0, double xscale=1, double xstart=0, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_TMP void PlotShaded(const char* label_id, const T* xs, const T* ys, int count, double yref=0, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotShaded64(const char* label_id, const T* xs, const T* ys, ImS64 count, double yref=0, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_TMP void PlotShaded(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, const ImPlotSpec& spec=ImPlotSpec());
+IMPLOT_TMP void PlotShaded64(const char* label_id, const T* xs, const T* ys1, const T* ys2, ImS64 count, const ImPlotSpec& spec=ImPlotSpec());
 IMPLOT_API void PlotShadedG(const char* label_id, ImPlotGetter getter1, void* data1, ImPlotGetter getter2, void* data2, int count, const ImPlotSpec& spec=ImPlotSpec());
 
 // Plots a bar graph. Vertical by default. #bar_size and #shift are in plot units.
@@ -1064,6 +1396,18 @@ IMPLOT_API void PlotText(const char* text, double x, double y, const ImVec2& pix
 // Plots a dummy item (i.e. adds a legend entry colored by ImPlotCol_Line)
 IMPLOT_API void PlotDummy(const char* label_id, const ImPlotSpec& spec=ImPlotSpec());
 
+//-----------------------------------------------------------------------------
+// [SECTION] Sparklines
+//-----------------------------------------------------------------------------
+
+// Renders #values as a compact line directly into the current ImGui window, as a single ImGui item of #size (e.g. an
+// inline sparkline in a table cell). Unlike PlotLine, this is called OUTSIDE of BeginPlot/EndPlot and creates no plot,
+// axes, legend or input state. Values are mapped linearly from [0,count-1] x [y_min,y_max] onto the item rect; if
+// y_min >= y_max, the range of the data is used. ImPlotSpec LineColor (defaults to ImGuiCol_PlotLines), LineWeight,
+// FillColor, FillAlpha, Offset and Stride are honored, and ImPlotLineFlags_Shaded fills down to y=0. Output is clipped to
+// the item rect. No frame or background is drawn (use a CanvasOnly plot for that, as in the demo).
+IMPLOT_TMP void Sparkline(const char* id, const T* values, int count, double y_min=0, double y_max=0, const ImVec2& size=ImVec2(-1,0), const ImPlotSpec& spec=ImPlotSpec());
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Tools
 //-----------------------------------------------------------------------------
@@ -1131,6 +1475,12 @@ IMPLOT_API bool IsAxisHovered(ImAxis axis);
 // Returns true if the bounding frame of a subplot is hovered.
 IMPLOT_API bool IsSubplotsHovered();
 
+// Returns the changes detected by the most recent EndPlot of the plot #title_id in the current window, compared to its
+// previous frame. Data changes within items are not tracked. Returns ImPlotChangeFlags_None if the plot does not exist.
+IMPLOT_API ImPlotChangeFlags GetPlotChanges(const char* title_id);
+// Returns true if any of #flags changed in the most recently ended plot. Call after EndPlot.
+IMPLOT_API bool IsPlotChanging(ImPlotChangeFlags flags = ImPlotChangeFlags_Limits);
+
 // Returns true if the current plot is being box selected.
 IMPLOT_API bool IsPlotSelected();
 // Returns the current plot box selection bounds. Passing IMPLOT_AUTO uses the current axes.
@@ -1142,6 +1492,11 @@ IMPLOT_API void CancelPlotSelection();
 // Use ImPlotCond_Always if you need to forcefully set this every frame.
 IMPLOT_API void HideNextItem(bool hidden = true, ImPlotCond cond = ImPlotCond_Once);
 
+// Returns the ID the current plot assigns to an item labeled #label_id. Store it and pass it as ImPlotSpec::ItemID
+// to skip hashing the label on every frame (useful when plotting thousands of named items). Call after BeginPlot;
+// this does not lock setup, so Setup* functions may still follow.
+IMPLOT_API ImGuiID GetItemID(const char* label_id);
+
 // Use the following around calls to Begin/EndPlot to align l/r/t/b padding.
 // Consider using Begin/EndSubplots first. They are more feature rich and
 // accomplish the same behaviour by default. The functions below offer lower
@@ -1354,6 +1709,17 @@ IMPLOT_API void ShowUserGuide();
 // Shows ImPlot metrics/debug information window.
 IMPLOT_API void ShowMetricsWindow(bool* p_popen = nullptr);
 
+// Enables/disables recording of per-plot and per-item cost statistics (timings, primitive, vertex and index counts).
+// Disabled by default. Can also be toggled from the metrics window. Do not call between BeginPlot/EndPlot.
+IMPLOT_API void SetStatsEnabled(bool enabled);
+// Returns true if cost statistics are being recorded.
+IMPLOT_API bool IsStatsEnabled();
+// Gets the statistics of the last completed frame of the plot #title_id in the current window. Returns false if the plot does not exist.
+IMPLOT_API bool GetPlotStats(const char* title_id, ImPlotPlotStats* stats);
+// Gets the statistics of the item #label_id from the last time it was plotted. Call between BeginPlot/EndPlot (this does
+// not lock setup). Returns false if the item does not exist.
+IMPLOT_API bool GetItemStats(const char* label_id, ImPlotItemStats* stats);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Demo
 //-----------------------------------------------------------------------------
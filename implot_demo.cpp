@@ -33,6 +33,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 // Clang warnings with -Weverything
@@ -329,6 +330,33 @@ void Demo_LinePlots() {
 
 //-----------------------------------------------------------------------------
 
+void Demo_SharedXLines() {
+    IMGUI_DEMO_MARKER("Plots/Shared X Lines");
+    static const int k_channels = 8, k_count = 1000;
+    static float xs[k_count];
+    static float ys[k_channels][k_count];
+    static const char* labels[k_channels] = { "Ch 0", "Ch 1", "Ch 2", "Ch 3", "Ch 4", "Ch 5", "Ch 6", "Ch 7" };
+    const float t = (float)ImGui::GetTime();
+    for (int i = 0; i < k_count; ++i) {
+        xs[i] = i * 0.01f;
+        for (int c = 0; c < k_channels; ++c)
+            ys[c][i] = c + 0.4f * sinf(xs[i] * (1 + c * 0.5f) + t);
+    }
+    const float* columns[k_channels];
+    for (int c = 0; c < k_channels; ++c)
+        columns[c] = ys[c];
+    ImGui::BulletText("PlotLines plots many series against one x array, e.g. channels sharing a timestamp array.");
+    ImGui::BulletText("The x values are transformed to pixels once for all series. Each series is its own legend item.");
+    if (ImPlot::BeginPlot("##SharedX")) {
+        ImPlot::SetupAxes("Time (s)", "Channel");
+        ImPlot::SetupAxesLimits(0, 10, -1, k_channels);
+        ImPlot::PlotLines(labels, xs, columns, k_channels, k_count);
+        ImPlot::EndPlot();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Demo_FilledLinePlots() {
     IMGUI_DEMO_MARKER("Plots/Filled Line Plots");
     static double xs1[101], ys1[101], ys2[101], ys3[101];
@@ -385,6 +413,48 @@ void Demo_FilledLinePlots() {
 
 //-----------------------------------------------------------------------------
 
+// Converts a float to IEEE 754 half precision, flushing values too small for a normal half to zero
+static ImPlotHalf FloatToHalf(float f) {
+    ImU32 bits;
+    memcpy(&bits, &f, sizeof(bits));
+    const ImU16 sign = (ImU16)((bits >> 16) & 0x8000);
+    const int   e    = (int)((bits >> 23) & 0xFF) - 127 + 15;
+    if (e <= 0)
+        return ImPlotHalf(sign);
+    if (e >= 31)
+        return ImPlotHalf((ImU16)(sign | 0x7C00));
+    return ImPlotHalf((ImU16)(sign | (e << 10) | ((bits >> 13) & 0x3FF)));
+}
+
+void Demo_ScaledSamples() {
+    IMGUI_DEMO_MARKER("Plots/Scaled Samples");
+    static ImS16      adc[1000];
+    static ImPlotHalf half[1000];
+    static bool init = true;
+    if (init) {
+        for (int i = 0; i < 1000; ++i) {
+            adc[i]  = (ImS16)(2048 + 1500 * sin(i * 0.02) + RandomRange(-50.0, 50.0));
+            half[i] = FloatToHalf(0.5f * cosf(i * 0.02f));
+        }
+        init = false;
+    }
+    static float gain = 1.0f / 4096;
+    static float bias = -0.5f;
+    ImGui::BulletText("PlotLineScaled decodes raw samples as scale * v + bias while plotting, without converting the buffer.");
+    ImGui::BulletText("It also accepts ImPlotHalf (binary16) samples.");
+    ImGui::DragFloat("ADC Gain", &gain, 0.00001f, 0, 0.001f, "%.6f");
+    ImGui::DragFloat("ADC Bias", &bias, 0.01f, -1, 1);
+    if (ImPlot::BeginPlot("##Scaled")) {
+        ImPlot::SetupAxes("Sample", "Volts");
+        ImPlot::SetupAxesLimits(0, 1000, -1, 1);
+        ImPlot::PlotLineScaled("ADC (int16)", adc, 1000, gain, bias);
+        ImPlot::PlotLineScaled("Half", half, 1000, 1.0, 0.0);
+        ImPlot::EndPlot();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Demo_ShadedPlots() {
     IMGUI_DEMO_MARKER("Plots/Shaded Plots");
     static float xs[1001], ys[1001], ys1[1001], ys2[1001], ys3[1001], ys4[1001];
@@ -1069,6 +1139,122 @@ void Demo_RealtimePlots() {
 
 //-----------------------------------------------------------------------------
 
+void Demo_StreamBuffer() {
+    IMGUI_DEMO_MARKER("Plots/Stream Buffer");
+    static ImPlotStreamBuffer stream(2000);
+    static double t = 0;
+    ImGui::BulletText("ImPlotStreamBuffer receives samples from a producer thread with Push(), which never blocks.");
+    ImGui::BulletText("Here the UI thread is also the producer, pushing a few samples every frame.");
+    const double dt = ImGui::GetIO().DeltaTime / 4;
+    for (int i = 0; i < 4; ++i) {
+        t += dt;
+        stream.Push(t, sin(2 * t) + RandomRange(-0.1, 0.1));
+    }
+    stream.Update();
+    ImGui::Text("History: %d samples", stream.Size());
+    if (ImPlot::BeginPlot("##Stream", ImVec2(-1,ImGui::GetTextLineHeight()*10))) {
+        ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_NoTickLabels);
+        ImPlot::SetupAxisLimits(ImAxis_X1, t - 5, t, ImGuiCond_Always);
+        ImPlot::SetupAxisLimits(ImAxis_Y1, -1.5, 1.5);
+        ImPlot::PlotLine("Signal", stream);
+        ImPlot::EndPlot();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Demo_DecimatedSeries() {
+    IMGUI_DEMO_MARKER("Plots/Decimated Series");
+    static ImPlotDecimatedSeries series;
+    static double y = 0;
+    static bool append = true;
+    static bool fit = true;
+    ImGui::BulletText("ImPlotDecimatedSeries keeps a min/max pyramid, so each frame costs O(pixels) at any zoom level.");
+    ImGui::BulletText("Zoom into the signal to see the raw samples.");
+    ImGui::Checkbox("Append", &append);
+    ImGui::SameLine();
+    ImGui::Checkbox("Auto-Fit", &fit);
+    ImGui::SameLine();
+    if (ImGui::Button("Clear")) {
+        series.Clear();
+        y = 0;
+    }
+    if (append) {
+        for (int i = 0; i < 1000; ++i) {
+            y += RandomRange(-0.01, 0.01);
+            series.Append(series.Size() * 0.001, y);
+        }
+    }
+    ImGui::SameLine();
+    ImGui::Text("%d samples", series.Size());
+    if (ImPlot::BeginPlot("##Decimated", ImVec2(-1,0))) {
+        const ImPlotAxisFlags flags = fit ? ImPlotAxisFlags_AutoFit : ImPlotAxisFlags_None;
+        ImPlot::SetupAxes("Time (s)", nullptr, flags, flags);
+        ImPlot::PlotLine("Random Walk", series);
+        ImPlot::EndPlot();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// The demo does not spawn threads (it must build without them), so jobs are queued here and run at the start of the
+// next frame, which stands in for a worker. A real application would hand jobs to its thread pool instead, and call
+// ImPlotAsyncSeries::Abandon() for any job the pool drops without running (e.g. on shutdown).
+struct AsyncDemoSeries {
+    void (*Job)(void*);
+    void* JobData;
+    ImPlotAsyncSeries Series;
+
+    AsyncDemoSeries() : Job(nullptr), JobData(nullptr), Series(Queue, this) { }
+    // a job still queued at exit will never run, so the series must not wait for it
+    ~AsyncDemoSeries() { if (Job != nullptr) Series.Abandon(); }
+
+    // the series runs at most one job at a time, so a single slot is enough
+    static void Queue(void (*job)(void*), void* job_data, void* user_data) {
+        AsyncDemoSeries* self = (AsyncDemoSeries*)user_data;
+        self->Job     = job;
+        self->JobData = job_data;
+    }
+    void RunQueued() {
+        if (Job == nullptr)
+            return;
+        void (*job)(void*) = Job;
+        Job = nullptr;
+        job(JobData);
+    }
+};
+
+void Demo_AsyncSeries() {
+    IMGUI_DEMO_MARKER("Plots/Async Series");
+    static const int k_count = 1000000;
+    static AsyncDemoSeries async;
+    ImPlotAsyncSeries& series = async.Series;
+    static ImVector<double> xs, ys;
+    async.RunQueued();
+    ImGui::BulletText("ImPlotAsyncSeries hands the decimation of %d samples to a task callback, so panning and zooming never stall.", k_count);
+    ImGui::BulletText("This demo runs each job at the start of the next frame; a real application would use a worker thread.");
+    ImGui::BulletText("Until a job completes, the last result is remapped to the current axes.");
+    const bool regenerate = ImGui::Button("Regenerate");
+    if (regenerate || xs.empty()) {
+        xs.resize(k_count);
+        ys.resize(k_count);
+        const double phase = RandomRange(0.0, 6.28);
+        for (int i = 0; i < k_count; ++i) {
+            xs[i] = i * 0.001;
+            ys[i] = sin(xs[i] + phase) + 0.25 * sin(xs[i] * 37.0) + RandomRange(-0.1, 0.1);
+        }
+        series.Submit(xs.Data, ys.Data, k_count);
+    }
+    ImGui::SameLine();
+    ImGui::TextUnformatted(series.Busy() ? "Job running..." : "Idle");
+    if (ImPlot::BeginPlot("##Async", ImVec2(-1,0))) {
+        ImPlot::PlotLine("Signal", series);
+        ImPlot::EndPlot();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Demo_MarkersAndText() {
     IMGUI_DEMO_MARKER("Plots/Markers and Text");
     static ImPlotSpec spec(ImPlotProp_Marker, ImPlotMarker_Auto);
@@ -1858,6 +2044,41 @@ void Demo_SubplotAxisLinking() {
 
 //-----------------------------------------------------------------------------
 
+void Demo_SmallMultiples() {
+    IMGUI_DEMO_MARKER("Subplots/Small Multiples");
+    static const int k_rows = 8, k_cols = 8, k_count = 100;
+    static float data[k_rows * k_cols][k_count];
+    static bool init = true;
+    static bool fixed_limits = false;
+    if (init) {
+        for (int i = 0; i < k_rows * k_cols; ++i) {
+            float y = 0;
+            for (int j = 0; j < k_count; ++j) {
+                y += RandomRange(-0.1f, 0.1f);
+                data[i][j] = y;
+            }
+        }
+        init = false;
+    }
+    ImGui::BulletText("Small multiples are a grid of plots that share one set of plot and axis flags.");
+    ImGui::BulletText("Cells scrolled out of view are skipped, and only the hovered cell processes input.");
+    ImGui::Checkbox("Fixed Y Limits", &fixed_limits);
+    const ImPlotAxisFlags y_flags = fixed_limits ? ImPlotAxisFlags_NoDecorations : ImPlotAxisFlags_NoDecorations | ImPlotAxisFlags_AutoFit;
+    if (ImPlot::BeginSmallMultiples("##SmallMultiples", k_rows, k_cols, ImVec2(-1,400), ImPlotFlags_CanvasOnly, ImPlotAxisFlags_NoDecorations | ImPlotAxisFlags_AutoFit, y_flags)) {
+        for (int i = 0; i < k_rows * k_cols; ++i) {
+            if (ImPlot::BeginSmallMultiple()) {
+                if (fixed_limits)
+                    ImPlot::SetupAxisLimits(ImAxis_Y1, -0.5, 0.5, ImPlotCond_Always);
+                ImPlot::PlotLine("##Data", data[i], k_count, 1, 0, {ImPlotProp_LineColor, ImPlot::GetColormapColor(i)});
+                ImPlot::EndSmallMultiple();
+            }
+        }
+        ImPlot::EndSmallMultiples();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Demo_LegendOptions() {
     IMGUI_DEMO_MARKER("Tools/Legend Options");
     static ImPlotLocation loc = ImPlotLocation_East;
@@ -2132,6 +2353,48 @@ void Demo_Querying() {
 
 //-----------------------------------------------------------------------------
 
+void Demo_ChangesAndStats() {
+    IMGUI_DEMO_MARKER("Tools/Changes and Stats");
+    static float data[10000];
+    static ImGuiID version = 0;
+    static bool retained = true;
+    static ImPlotItemStats item_stats;
+    const bool regenerate = ImGui::Button("Regenerate Data");
+    if (regenerate || version == 0) {
+        for (int i = 0; i < 10000; ++i)
+            data[i] = sinf(i * 0.005f) + RandomRange(-0.2f, 0.2f);
+        ++version;
+    }
+    ImGui::BulletText("With ImPlotFlags_Retained and a content hash, an idle plot replays its last draw output.");
+    ImGui::BulletText("GetPlotChanges reports what changed in a plot since its previous frame.");
+    ImGui::Checkbox("ImPlotFlags_Retained", &retained);
+    ImGui::SameLine();
+    bool stats = ImPlot::IsStatsEnabled();
+    if (ImGui::Checkbox("Record Stats", &stats))
+        ImPlot::SetStatsEnabled(stats);
+    // the data version is the content hash: it changes whenever the data does
+    ImPlot::SetNextPlotContentHash(version);
+    if (ImPlot::BeginPlot("Changes", ImVec2(-1,0), retained ? ImPlotFlags_Retained : ImPlotFlags_None)) {
+        ImPlot::PlotLine("Signal", data, 10000);
+        ImPlot::GetItemStats("Signal", &item_stats);
+        ImPlot::EndPlot();
+    }
+    const ImPlotChangeFlags changes = ImPlot::GetPlotChanges("Changes");
+    ImGui::Text("Changes: %s%s%s%s%s%s", changes == ImPlotChangeFlags_None ? "None " : "",
+                (changes & ImPlotChangeFlags_Limits)    ? "Limits "    : "",
+                (changes & ImPlotChangeFlags_Size)      ? "Size "      : "",
+                (changes & ImPlotChangeFlags_Items)     ? "Items "     : "",
+                (changes & ImPlotChangeFlags_Hover)     ? "Hover "     : "",
+                (changes & ImPlotChangeFlags_Selection) ? "Selection " : "");
+    ImPlotPlotStats plot_stats;
+    if (stats && ImPlot::GetPlotStats("Changes", &plot_stats)) {
+        ImGui::Text("Plot: %.1f us (setup %.1f us, items %.1f us, end %.1f us)", plot_stats.Time, plot_stats.SetupTime, plot_stats.ItemTime, plot_stats.EndTime);
+        ImGui::Text("Signal: %.1f us, %d prims (%d culled), %d vtx, %d idx", item_stats.Time, (int)item_stats.Prims, (int)item_stats.PrimsCulled, item_stats.VtxCount, item_stats.IdxCount);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void Demo_Annotations() {
     IMGUI_DEMO_MARKER("Tools/Annotations");
     static bool clamp = false;
@@ -2369,9 +2632,13 @@ void Demo_Tables() {
     static ImGuiTableFlags flags = ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV |
                                    ImGuiTableFlags_RowBg | ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable;
     static bool anim = true;
+    static bool inline_sparklines = false;
     static int offset = 0;
     ImGui::BulletText("Plots can be used inside of ImGui tables as another means of creating subplots.");
+    ImGui::BulletText("ImPlot::Sparkline draws a bare line straight into the cell without creating a plot (cheaper, but no frame).");
     ImGui::Checkbox("Animate",&anim);
+    ImGui::SameLine();
+    ImGui::Checkbox("ImPlot::Sparkline",&inline_sparklines);
     if (anim)
         offset = (offset + 1) % 100;
     if (ImGui::BeginTable("##table", 3, flags, ImVec2(-1,0))) {
@@ -2392,7 +2659,12 @@ void Demo_Tables() {
             ImGui::Text("%.3f V", data[offset]);
             ImGui::TableSetColumnIndex(2);
             ImGui::PushID(row);
-            MyImPlot::Sparkline("##spark",data,100,0,11.0f,offset,ImPlot::GetColormapColor(row),ImVec2(-1, 35));
+            const ImVec4 col = ImPlot::GetColormapColor(row);
+            if (inline_sparklines)
+                ImPlot::Sparkline("##spark",data,100,0,11.0f,ImVec2(-1, 35),{ImPlotProp_LineColor, col, ImPlotProp_FillColor, col, ImPlotProp_FillAlpha, 0.25f,
+                                                                              ImPlotProp_Offset, offset, ImPlotProp_Flags, ImPlotLineFlags_Shaded});
+            else
+                MyImPlot::Sparkline("##spark",data,100,0,11.0f,offset,col,ImVec2(-1, 35));
             ImGui::PopID();
         }
         ImPlot::PopColormap();
@@ -2807,12 +3079,17 @@ void ShowDemoWindow(bool* p_open) {
     if (ImGui::BeginTabBar("ImPlotDemoTabs")) {
         if (ImGui::BeginTabItem("Plots")) {
             DemoHeader("Line Plots", Demo_LinePlots);
+            DemoHeader("Shared X Lines", Demo_SharedXLines);
             DemoHeader("Filled Line Plots", Demo_FilledLinePlots);
+            DemoHeader("Scaled Samples", Demo_ScaledSamples);
             DemoHeader("Shaded Plots##", Demo_ShadedPlots);
             DemoHeader("Scatter Plots", Demo_ScatterPlots);
             DemoHeader("Bubble Plots", Demo_BubblePlots);
             DemoHeader("Polygon Plots", Demo_PolygonPlots);
             DemoHeader("Realtime Plots", Demo_RealtimePlots);
+            DemoHeader("Stream Buffer", Demo_StreamBuffer);
+            DemoHeader("Decimated Series", Demo_DecimatedSeries);
+            DemoHeader("Async Series", Demo_AsyncSeries);
             DemoHeader("Stairstep Plots", Demo_StairstepPlots);
             DemoHeader("Bar Plots", Demo_BarPlots);
             DemoHeader("Bar Groups", Demo_BarGroups);
@@ -2835,6 +3112,7 @@ void ShowDemoWindow(bool* p_open) {
             DemoHeader("Sizing", Demo_SubplotsSizing);
             DemoHeader("Item Sharing", Demo_SubplotItemSharing);
             DemoHeader("Axis Linking", Demo_SubplotAxisLinking);
+            DemoHeader("Small Multiples", Demo_SmallMultiples);
             DemoHeader("Tables", Demo_Tables);
             ImGui::EndTabItem();
         }
@@ -2858,6 +3136,7 @@ void ShowDemoWindow(bool* p_open) {
             DemoHeader("Drag Lines", Demo_DragLines);
             DemoHeader("Drag Rects", Demo_DragRects);
             DemoHeader("Querying", Demo_Querying);
+            DemoHeader("Changes and Stats", Demo_ChangesAndStats);
             DemoHeader("Annotations", Demo_Annotations);
             DemoHeader("Tags", Demo_Tags);
             DemoHeader("Drag and Drop", Demo_DragAndDrop);
@@ -77,6 +77,22 @@ constexpr int IMPLOT_NUM_Y_AXES = ImAxis_COUNT - IMPLOT_NUM_X_AXES;
     ImU32 g = ((col >> IM_COL32_G_SHIFT) & 0xFF); \
     ImU32 b = ((col >> IM_COL32_B_SHIFT) & 0xFF);
 
+// Profiler hooks placed around ImPlot's costly internal stages. No-ops by default; define them in your imconfig.h or
+// build flags to route zones to an external profiler. #name is a string literal. IMPLOT_PROFILE_SCOPE covers the rest
+// of the enclosing scope; IMPLOT_PROFILE_BEGIN/END are always paired within the same scope. For example with Tracy:
+//   #define IMPLOT_PROFILE_SCOPE(name) ZoneScopedN(name)
+//   #define IMPLOT_PROFILE_BEGIN(name) TracyCZoneN(implot_zone, name, 1)
+//   #define IMPLOT_PROFILE_END(name)   TracyCZoneEnd(implot_zone)
+#ifndef IMPLOT_PROFILE_SCOPE
+#define IMPLOT_PROFILE_SCOPE(name)
+#endif
+#ifndef IMPLOT_PROFILE_BEGIN
+#define IMPLOT_PROFILE_BEGIN(name)
+#endif
+#ifndef IMPLOT_PROFILE_END
+#define IMPLOT_PROFILE_END(name)
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] Forward Declarations
 //-----------------------------------------------------------------------------
@@ -95,7 +111,7 @@ struct ImPlotTicker;
 //-----------------------------------------------------------------------------
 
 #ifndef GImPlot
-extern IMPLOT_API ImPlotContext* GImPlot; // Current implicit context pointer
+extern IMPLOT_API IMPLOT_THREAD_LOCAL ImPlotContext* GImPlot; // Current implicit context pointer
 #endif
 
 //-----------------------------------------------------------------------------
@@ -109,6 +125,30 @@ static inline float  ImSinh(float x)   { return sinhf(x);  }
 static inline double ImSinh(double x)  { return sinh(x);   }
 static inline float  ImAsinh(float x)  { return asinhf(x); }
 static inline double ImAsinh(double x) { return asinh(x);  }
+// Computes the natural logarithm with a branch-light approximation (~1e-9 absolute error). Non-normal or non-positive inputs fall back to log.
+static inline double ImLogFast(double x) {
+    if (!(x >= DBL_MIN && x <= DBL_MAX))
+        return log(x);
+    // decompose x = m * 2^e with m in [sqrt(1/2), sqrt(2)), then ln(m) = 2*atanh(z) with z = (m-1)/(m+1)
+    ImU64 bits; memcpy(&bits, &x, sizeof(bits));
+    int e = (int)((bits >> 52) & 0x7FF) - 1023;
+    bits = (bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull;
+    double m; memcpy(&m, &bits, sizeof(m));
+    if (m > 1.4142135623730951) { m *= 0.5; e++; }
+    const double z  = (m - 1.0) / (m + 1.0);
+    const double z2 = z * z;
+    return e * 0.6931471805599453 + 2.0 * z * (1.0 + z2 * (1.0/3.0 + z2 * (1.0/5.0 + z2 * (1.0/7.0 + z2 * (1.0/9.0)))));
+}
+// Computes the common (base-10) logarithm with ImLogFast
+static inline double ImLog10Fast(double x) { return ImLogFast(x) * 0.4342944819032518; }
+// Computes the inverse hyperbolic sine with ImLogFast
+static inline double ImAsinhFast(double x) {
+    const double ax = x < 0 ? -x : x;
+    if (ax > 1e150)
+        return asinh(x);
+    const double r = ImLogFast(ax + sqrt(ax * ax + 1.0));
+    return x < 0 ? -r : r;
+}
 // Returns true if a flag is set
 template <typename TSet, typename TFlag>
 static inline bool ImHasFlag(TSet set, TFlag flag) { return (set & flag) == flag; }
@@ -123,6 +163,7 @@ template <typename T>
 static inline T ImRemap01(T x, T x0, T x1) { return (x - x0) / (x1 - x0); }
 // Returns always positive modulo (assumes r != 0)
 static inline int ImPosMod(int l, int r) { return (l % r + r) % r; }
+static inline ImS64 ImPosMod(ImS64 l, ImS64 r) { return (l % r + r) % r; }
 // Returns true if val is NAN
 static inline bool ImNan(double val) { return isnan(val); }
 // Returns true if val is NAN or INFINITY
@@ -651,6 +692,151 @@ struct ImPlotTicker {
     }
 };
 
+// Bump allocator for transient per-frame memory. Allocations stay valid until the next Reset, which happens once per frame.
+// Requests that don't fit in the current block are served from the heap and the block is grown to the high-water mark on Reset,
+// so a steady-state frame performs no allocations. The high-water mark only remembers the last DecayFrames frames, and the block
+// is shrunk once it is more than four times larger than that, so a single large frame doesn't pin its memory for the context lifetime.
+struct ImPlotArena {
+    enum { DecayFrames = 600 };
+    char*           Data;
+    size_t          Capacity;
+    size_t          Offset;       // bytes used in Data this frame
+    size_t          Used;         // bytes requested this frame, including overflow
+    size_t          HighWater;    // max bytes requested in a single frame over the last DecayFrames frames
+    size_t          WindowPeak;   // max bytes requested in a single frame since the last decay
+    int             WindowFrames; // frames since the last decay
+    ImVector<void*> Overflow;     // heap allocations that did not fit in Data, freed on Reset
+
+    ImPlotArena() { Data = nullptr; Capacity = Offset = Used = HighWater = WindowPeak = 0; WindowFrames = 0; }
+    ~ImPlotArena() {
+        for (int i = 0; i < Overflow.Size; ++i)
+            IM_FREE(Overflow[i]);
+        if (Data != nullptr)
+            IM_FREE(Data);
+    }
+
+    void* Alloc(size_t size) {
+        size = (size + 15) & ~(size_t)15;
+        Used += size;
+        HighWater = ImMax(HighWater, Used);
+        if (Offset + size <= Capacity) {
+            void* ptr = Data + Offset;
+            Offset += size;
+            return ptr;
+        }
+        void* ptr = IM_ALLOC(size);
+        Overflow.push_back(ptr);
+        return ptr;
+    }
+
+    template <typename T>
+    T* AllocArray(ImS64 count) { IM_ASSERT(count >= 0); return (T*)Alloc(sizeof(T) * (size_t)count); }
+
+    void Reset() {
+        for (int i = 0; i < Overflow.Size; ++i)
+            IM_FREE(Overflow[i]);
+        Overflow.shrink(0);
+        WindowPeak = ImMax(WindowPeak, Used);
+        if (++WindowFrames >= DecayFrames) {
+            HighWater    = WindowPeak;
+            WindowPeak   = 0;
+            WindowFrames = 0;
+        }
+        if (HighWater > Capacity || HighWater < Capacity / 4) {
+            if (Data != nullptr)
+                IM_FREE(Data);
+            Capacity = HighWater;
+            Data     = Capacity > 0 ? (char*)IM_ALLOC(Capacity) : nullptr;
+        }
+        Offset = Used = 0;
+    }
+};
+
+// Inputs that fully determine the output of an axis locator
+struct ImPlotTickerKey {
+    ImPlotRange     Range;
+    float           Pixels;
+    bool            Vertical;
+    ImPlotLocator   Locator;
+    ImPlotFormatter Formatter;
+    void*           FormatterData;
+    const char*     Format;        // FormatterData as a format string when Formatter is Formatter_Default, else nullptr
+    ImFont*         Font;
+    float           FontSize;
+    bool            UseLocalTime;  // style flags that change the labels of Locator_Time
+    bool            UseISO8601;
+    bool            Use24HourClock;
+
+    bool operator==(const ImPlotTickerKey& other) const {
+        if (Range.Min != other.Range.Min || Range.Max != other.Range.Max || Pixels != other.Pixels || Vertical != other.Vertical ||
+            Locator != other.Locator || Formatter != other.Formatter || Font != other.Font || FontSize != other.FontSize ||
+            UseLocalTime != other.UseLocalTime || UseISO8601 != other.UseISO8601 || Use24HourClock != other.Use24HourClock)
+            return false;
+        if (FormatterData == other.FormatterData)
+            return true;
+        // format specs live in each axis, so compare their contents instead
+        return Format != nullptr && other.Format != nullptr && strcmp(Format, other.Format) == 0;
+    }
+};
+
+// Tickers computed during the current frame, shared by axes with identical locator inputs (e.g. linked or aligned axes)
+struct ImPlotTickerCache {
+    ImVector<ImPlotTickerKey> Keys;
+    ImVector<ImPlotTicker*>   Tickers; // persistent storage, grows to the max number of unique tickers in a frame
+    int                       Hits;
+
+    ImPlotTickerCache() { Hits = 0; }
+    ~ImPlotTickerCache() {
+        for (int i = 0; i < Tickers.Size; ++i)
+            IM_DELETE(Tickers[i]);
+    }
+
+    ImPlotTicker* Find(const ImPlotTickerKey& key) {
+        for (int i = 0; i < Keys.Size; ++i) {
+            if (Keys[i] == key)
+                return Tickers[i];
+        }
+        return nullptr;
+    }
+
+    ImPlotTicker* Add(const ImPlotTickerKey& key) {
+        if (Keys.Size == Tickers.Size)
+            Tickers.push_back(IM_NEW(ImPlotTicker)());
+        ImPlotTicker* ticker = Tickers[Keys.Size];
+        ticker->Reset();
+        Keys.push_back(key);
+        return ticker;
+    }
+
+    void Reset() {
+        Keys.shrink(0);
+        Hits = 0;
+    }
+};
+
+// Size of a label that usually stays the same from frame to frame (titles, axis labels). Remeasured when the text or font changes.
+struct ImPlotTextSizeCache
+{
+    ImGuiID Hash;
+    ImFont* Font;
+    float   FontSize;
+    ImVec2  Size;
+
+    ImPlotTextSizeCache() { Hash = 0; Font = nullptr; FontSize = 0; }
+
+    ImVec2 Calc(const char* text, bool hide_text_after_double_hash) {
+        ImGuiContext& G = *GImGui;
+        const ImGuiID hash = ImHashStr(text);
+        if (hash != Hash || G.Font != Font || G.FontSize != FontSize) {
+            Size     = ImGui::CalcTextSize(text, nullptr, hide_text_after_double_hash);
+            Hash     = hash;
+            Font     = G.Font;
+            FontSize = G.FontSize;
+        }
+        return Size;
+    }
+};
+
 // Axis state information that must persist after EndPlot
 struct ImPlotAxis
 {
@@ -687,6 +873,7 @@ struct ImPlotAxis
 
     ImRect               HoverRect;
     int                  LabelOffset;
+    ImPlotTextSizeCache  LabelSize;
     ImU32                ColorMaj, ColorMin, ColorTick, ColorTxt, ColorBg, ColorHov, ColorAct, ColorHiLi;
 
     bool                 Enabled;
@@ -975,6 +1162,11 @@ struct ImPlotItem
     ImPlotMarker Marker;
     ImRect       LegendHoverRect;
     int          NameOffset;
+    ImGuiID      LabelHash;     // hash of the legend label LabelWidth was measured for
+    float        LabelWidth;    // cached legend label width, or -1 if not yet measured
+    ImFont*      LabelFont;     // font LabelWidth was measured with
+    float        LabelFontSize; // font size LabelWidth was measured with
+    ImPlotItemStats Stats;      // cost statistics from the last time the item was plotted
     bool         Show;
     bool         LegendHovered;
     bool         SeenThisFrame;
@@ -984,6 +1176,10 @@ struct ImPlotItem
         Color         = IM_COL32_WHITE;
         Marker        = ImPlotMarker_None;
         NameOffset    = -1;
+        LabelHash     = 0;
+        LabelWidth    = -1;
+        LabelFont     = nullptr;
+        LabelFontSize = 0;
         Show          = true;
         SeenThisFrame = false;
         LegendHovered = false;
@@ -1002,6 +1198,9 @@ struct ImPlotLegend
     ImVec2            Scroll;
     ImVector<int>     Indices;
     ImGuiTextBuffer   Labels;
+    ImGuiID           Signature;       // hash of the legend item IDs in submission order, rebuilt every frame
+    ImVector<int>     SortedIndices;   // cached sorted render order (ImPlotLegendFlags_Sort)
+    ImGuiID           SortedSignature; // GetLegendLabelsHash() that SortedIndices was computed for
     ImRect            Rect;
     ImRect            RectClamped;
     bool              Hovered;
@@ -1014,9 +1213,10 @@ struct ImPlotLegend
         Hovered      = Held = false;
         Location     = PreviousLocation = ImPlotLocation_NorthWest;
         Scroll       = ImVec2(0,0);
+        Signature    = SortedSignature = 0;
     }
 
-    void Reset() { Indices.shrink(0); Labels.Buf.shrink(0); }
+    void Reset() { Indices.shrink(0); Labels.Buf.shrink(0); Signature = 0; }
 };
 
 // Holds Items and Legend data
@@ -1040,9 +1240,74 @@ struct ImPlotItemGroup
     int         GetLegendCount() const           { return Legend.Indices.size();                                 }
     ImPlotItem* GetLegendItem(int i)             { return ItemPool.GetByIndex(Legend.Indices[i]);                }
     const char* GetLegendLabel(int i)            { return Legend.Labels.Buf.Data + GetLegendItem(i)->NameOffset; }
+    // Returns the width of a legend label, measuring it only if the label, font or font size changed since it was last measured
+    // Label hashes are only computed here, for the entries that are laid out, so that registering items stays hash-free
+    float GetLegendLabelWidth(int i) {
+        ImPlotItem* item = GetLegendItem(i);
+        const char* label = GetLegendLabel(i);
+        const ImGuiID label_hash = ImHashData(label, strlen(label));
+        ImFont* font = ImGui::GetFont();
+        const float font_size = ImGui::GetFontSize();
+        if (item->LabelWidth < 0 || item->LabelHash != label_hash || item->LabelFont != font || item->LabelFontSize != font_size) {
+            item->LabelWidth    = ImGui::CalcTextSize(label, nullptr, true).x;
+            item->LabelHash     = label_hash;
+            item->LabelFont     = font;
+            item->LabelFontSize = font_size;
+        }
+        return item->LabelWidth;
+    }
+    // Hash of the legend labels in order. Legend.Signature only covers item IDs, which a "###" label keeps when its text changes.
+    ImGuiID GetLegendLabelsHash() {
+        ImGuiID hash = Legend.Signature;
+        for (int i = 0; i < GetLegendCount(); ++i) {
+            const char* label = GetLegendLabel(i);
+            hash = ImHashData(label, strlen(label), hash);
+        }
+        return hash;
+    }
     void        Reset()                          { ItemPool.Clear(); Legend.Reset(); ColormapIdx = 0;            }
 };
 
+// Draw command captured from a retained plot. Positions are relative to the plot frame origin.
+struct ImPlotRetainedCmd
+{
+    ImDrawCmd Cmd;       // clip rect and texture of the original draw command
+    int       VtxOffset; // first vertex in ImPlotRetainedDrawData::VtxBuffer
+    int       VtxCount;
+    int       IdxOffset; // first index in ImPlotRetainedDrawData::IdxBuffer, relative to VtxOffset
+    int       IdxCount;
+};
+
+// Draw output of an idle plot which is replayed while the plot stays idle (see ImPlotFlags_Retained)
+struct ImPlotRetainedDrawData
+{
+    ImVector<ImDrawVert>        VtxBuffer;
+    ImVector<unsigned int>      IdxBuffer;
+    ImVector<ImPlotRetainedCmd> Cmds;
+    ImGuiID                     Key;       // content hash combined with the size, clipping and style the draw data was captured with
+    bool                        Valid;
+    // capture state of the current frame
+    ImGuiID                     CaptureKey;
+    int                         CaptureIdx0;
+    bool                        Capturing;
+
+    ImPlotRetainedDrawData() { Key = CaptureKey = 0; CaptureIdx0 = 0; Valid = Capturing = false; }
+    void Clear() { VtxBuffer.shrink(0); IdxBuffer.shrink(0); Cmds.shrink(0); Valid = false; }
+};
+
+// Snapshot of the plot state compared between frames to detect changes (see GetPlotChanges)
+struct ImPlotChangeState
+{
+    ImPlotRange Ranges[ImAxis_COUNT];
+    int         EnabledAxes;   // bitmask of enabled axes
+    ImGuiID     SizeHash;      // hash of the frame and plot rects
+    ImGuiID     ItemsHash;
+    ImGuiID     HoverHash;
+    ImGuiID     SelectionHash;
+
+    ImPlotChangeState() { EnabledAxes = 0; SizeHash = ItemsHash = HoverHash = SelectionHash = 0; }
+};
+
 // Holds Plot state information that must persist after EndPlot
 struct ImPlotPlot
 {
@@ -1063,6 +1328,7 @@ struct ImPlotPlot
     ImRect               SelectRect;
     ImVec2               SelectStart;
     int                  TitleOffset;
+    ImPlotTextSizeCache  TitleSize;
     bool                 JustCreated;
     bool                 Initialized;
     bool                 SetupLocked;
@@ -1072,6 +1338,11 @@ struct ImPlotPlot
     bool                 Selecting;
     bool                 Selected;
     bool                 ContextLocked;
+    ImPlotPlotStats      Stats;        // cost statistics of the last completed frame
+    ImPlotPlotStats      CurrentStats; // cost statistics being recorded this frame
+    ImPlotRetainedDrawData Retained;   // cached draw output (see ImPlotFlags_Retained)
+    ImPlotChangeFlags    Changes;      // changes detected by the last EndPlot
+    ImPlotChangeState    ChangeState;  // state the changes were detected against
 
     ImPlotPlot() {
         Flags             = PreviousFlags = ImPlotFlags_None;
@@ -1085,6 +1356,7 @@ struct ImPlotPlot
         MouseTextLocation  = ImPlotLocation_South | ImPlotLocation_East;
         MouseTextFlags     = ImPlotMouseTextFlags_None;
         TitleOffset       = -1;
+        Changes           = ImPlotChangeFlags_All;
         JustCreated       = true;
         Initialized = SetupLocked = FitThisFrame = false;
         Hovered = Held = Selected = Selecting = ContextLocked = false;
@@ -1166,9 +1438,18 @@ struct ImPlotSubplot {
     ImVector<float>               ColRatios;
     ImVector<ImPlotRange>         RowLinkData;
     ImVector<ImPlotRange>         ColLinkData;
+    ImVector<float>               RowOffsets;    // cumulative RowRatios, updated once per frame
+    ImVector<float>               ColOffsets;    // cumulative ColRatios, updated once per frame
+    ImPlotTextSizeCache           TitleSize;
+    ImVec2                        LegendSize;    // shared legend size measured by the last EndSubplots
+    ImGuiID                       LegendSizeKey; // legend signature, orientation and font LegendSize was measured with
     float                         TempSizes[2];
     bool                          FrameHovered;
     bool                          HasTitle;
+    bool                          Batched;        // true between BeginSmallMultiples() and EndSmallMultiples()
+    ImPlotFlags                   BatchPlotFlags; // plot flags shared by every small multiple
+    ImPlotAxisFlags               BatchXFlags;    // x-axis flags shared by every small multiple
+    ImPlotAxisFlags               BatchYFlags;    // y-axis flags shared by every small multiple
 
     ImPlotSubplot() {
         ID                          = 0;
@@ -1178,8 +1459,13 @@ struct ImPlotSubplot {
         Items.Legend.Flags          = ImPlotLegendFlags_Horizontal|ImPlotLegendFlags_Outside;
         Items.Legend.CanGoInside    = false;
         TempSizes[0] = TempSizes[1] = 0;
+        LegendSize                  = ImVec2(0,0);
+        LegendSizeKey               = 0;
         FrameHovered                = false;
         HasTitle                    = false;
+        Batched                     = false;
+        BatchPlotFlags              = ImPlotFlags_None;
+        BatchXFlags = BatchYFlags   = ImPlotAxisFlags_None;
     }
 };
 
@@ -1192,6 +1478,8 @@ struct ImPlotNextPlotData
     bool        Fit[ImAxis_COUNT];
     double*     LinkedMin[ImAxis_COUNT];
     double*     LinkedMax[ImAxis_COUNT];
+    ImGuiID     ContentHash;
+    bool        HasContentHash;
 
     ImPlotNextPlotData() { Reset(); }
 
@@ -1201,6 +1489,8 @@ struct ImPlotNextPlotData
             Fit[i]                      = false;
             LinkedMin[i] = LinkedMax[i] = nullptr;
         }
+        ContentHash    = 0;
+        HasContentHash = false;
     }
 
 };
@@ -1236,7 +1526,8 @@ struct ImPlotContext {
     ImPlotItem*           PreviousItem;
 
     // Tick Marks and Labels
-    ImPlotTicker CTicker;
+    ImPlotTicker      CTicker;
+    ImPlotTickerCache TickerCache;
 
     // Annotation and Tabs
     ImPlotAnnotationCollection Annotations;
@@ -1253,18 +1544,26 @@ struct ImPlotContext {
     tm Tm;
 
     // Temp data for general use
-    ImVector<double>   TempDouble1, TempDouble2;
-    ImVector<int>      TempInt1;
+    ImPlotArena        FrameArena; // transient memory, reset at the start of each frame
+    int                FrameCount; // ImGui frame the per-frame state was last reset on
+
+    // Statistics
+    bool               StatsEnabled;   // record per-plot and per-item cost statistics
+    double             StatsPlotStart; // time the current plot began
+    double             StatsItemStart; // time the current item began
+    int                StatsItemVtx0;  // plot draw list vertex count when the current item began
+    int                StatsItemIdx0;  // plot draw list index count when the current item began
+    ImPlotItemStats    StatsItem;      // statistics being recorded for the current item
 
     // Misc
     int                DigitalPlotItemCnt;
     int                DigitalPlotOffset;
     ImPlotNextPlotData NextPlotData;
     ImPlotNextItemData NextItemData;
+    ImPlotChangeFlags  LastPlotChanges; // changes detected by the most recent EndPlot
     ImPlotInputMap     InputMap;
     bool               OpenContextThisFrame;
     ImGuiTextBuffer    MousePosStringBuilder;
-    ImPlotItemGroup*   SortItems;
 
     // Align plots
     ImPool<ImPlotAlignmentData> AlignmentData;
@@ -1291,6 +1590,10 @@ IMPLOT_API void ResetCtxForNextPlot(ImPlotContext* ctx);
 IMPLOT_API void ResetCtxForNextAlignedPlots(ImPlotContext* ctx);
 // Resets an ImPlot context for the next call to BeginSubplot
 IMPLOT_API void ResetCtxForNextSubplot(ImPlotContext* ctx);
+// Resets per-frame ImPlot context state (arena, ticker cache) if a new ImGui frame has started
+IMPLOT_API void ResetCtxForNextFrame(ImPlotContext* ctx);
+// Gets a high resolution timestamp in microseconds, used for recording cost statistics
+IMPLOT_API double GetStatsTime();
 
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Utils
@@ -1339,9 +1642,16 @@ IMPLOT_API bool BeginItem(const char* label_id, const ImPlotSpec& spec = ImPlotS
 template <typename _Fitter>
 bool BeginItemEx(const char* label_id, const _Fitter& fitter, const ImPlotSpec& spec, const ImVec4& item_col = IMPLOT_AUTO_COL, ImPlotMarker item_mkr = ImPlotMarker_Invalid) {
     if (BeginItem(label_id, spec, item_col, item_mkr)) {
+        ImPlotContext& gp = *GImPlot;
         ImPlotPlot& plot = *GetCurrentPlot();
-        if (plot.FitThisFrame && !ImHasFlag(spec.Flags, ImPlotItemFlags_NoFit))
+        if (plot.FitThisFrame && !ImHasFlag(spec.Flags, ImPlotItemFlags_NoFit)) {
+            const double fit_start = gp.StatsEnabled ? GetStatsTime() : 0;
+            IMPLOT_PROFILE_BEGIN("ImPlot::FitItem");
             fitter.Fit(plot.Axes[plot.CurrentX], plot.Axes[plot.CurrentY]);
+            IMPLOT_PROFILE_END("ImPlot::FitItem");
+            if (gp.StatsEnabled)
+                gp.StatsItem.FitTime += GetStatsTime() - fit_start;
+        }
         return true;
     }
     return false;
@@ -1352,8 +1662,14 @@ IMPLOT_API void EndItem();
 
 // Register or get an existing item from the current plot.
 IMPLOT_API ImPlotItem* RegisterOrGetItem(const char* label_id, ImPlotItemFlags flags, bool* just_created = nullptr);
+// Register or get an existing item from the current plot using a precomputed ID (see GetItemID).
+IMPLOT_API ImPlotItem* RegisterOrGetItemByID(ImGuiID id, const char* label_id, ImPlotItemFlags flags, bool* just_created = nullptr);
 // Get a plot item from the current plot.
 IMPLOT_API ImPlotItem* GetItem(const char* label_id);
+// Returns true if the item #label_id of the current plot exists and is hidden.
+IMPLOT_API bool IsItemHidden(const char* label_id);
+// Returns true if the item with a precomputed ID (see GetItemID) exists and is hidden.
+IMPLOT_API bool IsItemHiddenByID(ImGuiID id);
 // Gets the current item.
 IMPLOT_API ImPlotItem* GetCurrentItem();
 // Busts the cache for every item for every plot in the current context.
@@ -1540,6 +1856,15 @@ void FillRange(ImVector<T>& buffer, int n, T vmin, T vmax) {
     }
 }
 
+// Fills a buffer of n samples linearly spaced from vmin to vmax
+template <typename T>
+void FillRange(T* buffer, int n, T vmin, T vmax) {
+    T step = (vmax - vmin) / (n - 1);
+    for (int i = 0; i < n; ++i) {
+        buffer[i] = vmin + i * step;
+    }
+}
+
 // Calculate histogram bin counts and widths
 template <typename TContainer>
 static inline void CalculateBins(const TContainer& values, int count, ImPlotBin meth, const ImPlotRange& range, int& bins_out, double& width_out) {
@@ -1708,6 +2033,11 @@ IMPLOT_API void Locator_Time(ImPlotTicker& ticker, const ImPlotRange& range, flo
 IMPLOT_API void Locator_Log10(ImPlotTicker& ticker, const ImPlotRange& range, float pixels, bool vertical, ImPlotFormatter formatter, void* formatter_data);
 IMPLOT_API void Locator_SymLog(ImPlotTicker& ticker, const ImPlotRange& range, float pixels, bool vertical, ImPlotFormatter formatter, void* formatter_data);
 
+// Computes the decade span and step of major ticks for a logarithmic axis. Returns false if the range crosses or touches zero.
+IMPLOT_API bool CalcLogarithmicExponents(const ImPlotRange& range, float pix, bool vertical, int& exp_min, int& exp_max, int& exp_step);
+// Adds logarithmic major (labeled) and minor (unlabeled) ticks for the decades computed by CalcLogarithmicExponents.
+IMPLOT_API void AddTicksLogarithmic(const ImPlotRange& range, int exp_min, int exp_max, int exp_step, ImPlotTicker& ticker, ImPlotFormatter formatter, void* data);
+
 } // namespace ImPlot
 
 #endif // #ifndef IMGUI_DISABLE
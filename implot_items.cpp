@@ -323,9 +323,13 @@ IMPLOT_INLINE void PrimRectLine(ImDrawList& draw_list, const ImVec2& Pmin, const
 //-----------------------------------------------------------------------------
 
 ImPlotItem* RegisterOrGetItem(const char* label_id, ImPlotItemFlags flags, bool* just_created) {
+    ImPlotContext& gp = *GImPlot;
+    return RegisterOrGetItemByID(gp.CurrentItems->GetItemID(label_id), label_id, flags, just_created);
+}
+
+ImPlotItem* RegisterOrGetItemByID(ImGuiID id, const char* label_id, ImPlotItemFlags flags, bool* just_created) {
     ImPlotContext& gp = *GImPlot;
     ImPlotItemGroup& Items = *gp.CurrentItems;
-    ImGuiID id = Items.GetItemID(label_id);
     if (just_created != nullptr)
         *just_created = Items.GetItem(id) == nullptr;
     ImPlotItem* item = Items.GetOrAddItem(id);
@@ -336,6 +340,7 @@ ImPlotItem* RegisterOrGetItem(const char* label_id, ImPlotItemFlags flags, bool*
     item->ID = id;
     if (!ImHasFlag(flags, ImPlotItemFlags_NoLegend) && ImGui::FindRenderedTextEnd(label_id, nullptr) != label_id) {
         Items.Legend.Indices.push_back(idx);
+        Items.Legend.Signature = ImHashData(&id, sizeof(id), Items.Legend.Signature);
         item->NameOffset = Items.Legend.Labels.size();
         Items.Legend.Labels.append(label_id, label_id + strlen(label_id) + 1);
     }
@@ -350,11 +355,33 @@ ImPlotItem* GetItem(const char* label_id) {
     return gp.CurrentItems->GetItem(label_id);
 }
 
+bool IsItemHiddenByID(ImGuiID id) {
+    ImPlotItem* item = GImPlot->CurrentItems->GetItem(id);
+    return item != nullptr && !item->Show;
+}
+
 bool IsItemHidden(const char* label_id) {
     ImPlotItem* item = GetItem(label_id);
     return item != nullptr && !item->Show;
 }
 
+ImGuiID GetItemID(const char* label_id) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "GetItemID() needs to be called between BeginPlot() and EndPlot()!");
+    // hash with the seed SetupFinish pushes for items, so that setup isn't locked and the ID matches ImGui::GetID later
+    return ImHashStr(label_id, 0, gp.CurrentItems->ID);
+}
+
+bool GetItemStats(const char* label_id, ImPlotItemStats* stats) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "GetItemStats() needs to be called between BeginPlot() and EndPlot()!");
+    ImPlotItem* item = gp.CurrentItems->GetItem(GetItemID(label_id));
+    if (item == nullptr)
+        return false;
+    *stats = item->Stats;
+    return true;
+}
+
 ImPlotItem* GetCurrentItem() {
     ImPlotContext& gp = *GImPlot;
     return gp.CurrentItem;
@@ -409,8 +436,10 @@ bool BeginItem(const char* label_id, const ImPlotSpec& spec, const ImVec4& item_
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
     SetupLock();
+    const double item_start = gp.StatsEnabled ? GetStatsTime() : 0;
     bool just_created;
-    ImPlotItem* item = RegisterOrGetItem(label_id, spec.Flags, &just_created);
+    ImPlotItem* item = spec.ItemID != 0 ? RegisterOrGetItemByID(spec.ItemID, label_id, spec.Flags, &just_created)
+                                            : RegisterOrGetItem(label_id, spec.Flags, &just_created);
     // set current item
     gp.CurrentItem = item;
     ImPlotNextItemData& s = gp.NextItemData;
@@ -475,6 +504,14 @@ bool BeginItem(const char* label_id, const ImPlotSpec& spec, const ImVec4& item_
         s.RenderMarkerLine = s.Spec.MarkerLineColor.w > 0 && s.Spec.LineWeight > 0;
         s.RenderMarkerFill = s.Spec.MarkerFillColor.w > 0;
         s.RenderMarkers = s.Spec.Marker >= 0 && (s.RenderMarkerFill || s.RenderMarkerLine);
+        // begin recording stats
+        if (gp.StatsEnabled) {
+            ImDrawList& draw_list = *GetPlotDrawList();
+            gp.StatsItem      = ImPlotItemStats();
+            gp.StatsItemStart = item_start;
+            gp.StatsItemVtx0  = draw_list.VtxBuffer.Size;
+            gp.StatsItemIdx0  = draw_list.IdxBuffer.Size;
+        }
         // push rendering clip rect
         PushPlotClipRect();
         return true;
@@ -486,6 +523,23 @@ void EndItem() {
     ImPlotContext& gp = *GImPlot;
     // pop rendering clip rect
     PopPlotClipRect();
+    // finish recording stats
+    if (gp.StatsEnabled) {
+        ImDrawList& draw_list  = *GetPlotDrawList();
+        ImPlotItemStats& stats = gp.StatsItem;
+        stats.Time     = GetStatsTime() - gp.StatsItemStart;
+        stats.VtxCount = draw_list.VtxBuffer.Size - gp.StatsItemVtx0;
+        stats.IdxCount = draw_list.IdxBuffer.Size - gp.StatsItemIdx0;
+        gp.CurrentItem->Stats = stats;
+        ImPlotPlotStats& plot_stats = gp.CurrentPlot->CurrentStats;
+        plot_stats.ItemCount++;
+        plot_stats.ItemTime    += stats.Time;
+        plot_stats.FitTime     += stats.FitTime;
+        plot_stats.Prims       += stats.Prims;
+        plot_stats.PrimsCulled += stats.PrimsCulled;
+        plot_stats.VtxCount    += stats.VtxCount;
+        plot_stats.IdxCount    += stats.IdxCount;
+    }
     // reset next item data
     gp.NextItemData.Reset();
     // set current item
@@ -497,32 +551,57 @@ void EndItem() {
 // [SECTION] Indexers
 //-----------------------------------------------------------------------------
 
+// Wraps an offset index back into [0,count). Offset is already in [0,count), so in-range indices only need a
+// subtraction, which keeps the 64-bit division off the per-sample path.
+IMPLOT_INLINE ImS64 WrapIndex(ImS64 idx, ImS64 count, ImS64 offset) {
+    const ImS64 i = offset + idx;
+    return i < count ? i : (i < 2 * count ? i - count : i % count);
+}
+
 template <typename T>
-IMPLOT_INLINE T IndexData(const T* data, int idx, int count, int offset, int stride) {
+IMPLOT_INLINE T IndexData(const T* data, ImS64 idx, ImS64 count, ImS64 offset, int stride) {
     const int s = ((offset == 0) << 0) | ((stride == sizeof(T)) << 1);
     switch (s) {
         case 3 : return data[idx];
-        case 2 : return data[(offset + idx) % count];
+        case 2 : return data[WrapIndex(idx, count, offset)];
         case 1 : return *(const T*)(const void*)((const unsigned char*)data + (size_t)((idx) ) * stride);
-        case 0 : return *(const T*)(const void*)((const unsigned char*)data + (size_t)((offset + idx) % count) * stride);
+        case 0 : return *(const T*)(const void*)((const unsigned char*)data + (size_t)(WrapIndex(idx, count, offset)) * stride);
         default: return T(0);
     }
 }
 
+// Converts a sample to double; ImPlotHalf is decoded from its binary16 bits through float
+template <typename T>
+IMPLOT_INLINE double DecodeSample(T v) {
+    return (double)v;
+}
+
+IMPLOT_INLINE double DecodeSample(ImPlotHalf v) {
+    const ImU32 sign = (ImU32)(v.Bits & 0x8000) << 16;
+    const ImU32 e    = (v.Bits >> 10) & 0x1F;
+    const ImU32 man  = v.Bits & 0x3FF;
+    if (e == 0) // zero and subnormals: man * 2^-24
+        return (sign ? -1.0 : 1.0) * (double)man * 5.9604644775390625e-8;
+    const ImU32 bits = sign | ((e == 0x1F ? 0xFFu : e + 112) << 23) | (man << 13);
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return (double)f;
+}
+
 template <typename T>
 struct IndexerIdx {
-    IndexerIdx(const T* data, int count, int offset = 0, int stride = sizeof(T)) :
+    IndexerIdx(const T* data, ImS64 count, ImS64 offset = 0, int stride = sizeof(T)) :
         Data(data),
         Count(count),
         Offset(count ? ImPosMod(offset, count) : 0),
         Stride(stride)
     { }
     template <typename I> IMPLOT_INLINE double operator[](I idx) const {
-        return (double)IndexData(Data, idx, Count, Offset, Stride);
+        return DecodeSample(IndexData(Data, idx, Count, Offset, Stride));
     }
     const T* Data;
-    int Count;
-    int Offset;
+    ImS64 Count;
+    ImS64 Offset;
     int Stride;
     typedef double value_type;
 };
@@ -543,7 +622,66 @@ struct IndexerAdd {
     const _Indexer2& Indexer2;
     double Scale1;
     double Scale2;
-    int Count;
+    ImS64 Count;
+    typedef double value_type;
+};
+
+// Indexes a ring buffer whose oldest element is at #offset as two linear runs, [offset,count) then [0,offset),
+// which avoids the modulo IndexerIdx needs for offset data
+template <typename T>
+struct IndexerRing {
+    IndexerRing(const T* data, ImS64 count, ImS64 offset) :
+        Data(data),
+        Count(count),
+        Offset(offset),
+        Run(count - offset)
+    { }
+    template <typename I> IMPLOT_INLINE double operator[](I idx) const {
+        const ImS64 i = (ImS64)idx;
+        return (double)(i < Run ? Data[Offset + i] : Data[i - Run]);
+    }
+    const T* Data;
+    ImS64 Count;
+    ImS64 Offset;
+    ImS64 Run;
+    typedef double value_type;
+};
+
+// Indexes raw samples (e.g. ADC counts or ImPlotHalf) and decodes them as Scale * v + Bias
+template <typename T>
+struct IndexerScaled {
+    IndexerScaled(const T* data, ImS64 count, double scale, double bias, ImS64 offset = 0, int stride = sizeof(T)) :
+        Data(data),
+        Count(count),
+        Offset(count ? ImPosMod(offset, count) : 0),
+        Stride(stride),
+        Scale(scale),
+        Bias(bias)
+    { }
+    template <typename I> IMPLOT_INLINE double operator[](I idx) const {
+        return DecodeSample(IndexData(Data, idx, Count, Offset, Stride)) * Scale + Bias;
+    }
+    const T* Data;
+    ImS64 Count;
+    ImS64 Offset;
+    int Stride;
+    double Scale;
+    double Bias;
+    typedef double value_type;
+};
+
+// Indexes a field of an array of records with a direct typed load (no offset, and no dispatch on the stride)
+template <typename T>
+struct IndexerRecord {
+    IndexerRecord(const T* data, int record_size) :
+        Data((const unsigned char*)(const void*)data),
+        RecordSize(record_size)
+    { }
+    template <typename I> IMPLOT_INLINE double operator[](I idx) const {
+        return (double)*(const T*)(const void*)(Data + (size_t)idx * RecordSize);
+    }
+    const unsigned char* Data;
+    int RecordSize;
     typedef double value_type;
 };
 
@@ -570,13 +708,13 @@ struct IndexerConst {
 
 template <typename _IndexerX, typename _IndexerY>
 struct GetterXY {
-    GetterXY(_IndexerX x, _IndexerY y, int count) : IndexerX(x), IndexerY(y), Count(count) { }
+    GetterXY(_IndexerX x, _IndexerY y, ImS64 count) : IndexerX(x), IndexerY(y), Count(count) { }
     template <typename I> IMPLOT_INLINE ImPlotPoint operator[](I idx) const {
         return ImPlotPoint(IndexerX[idx],IndexerY[idx]);
     }
     const _IndexerX IndexerX;
     const _IndexerY IndexerY;
-    const int Count;
+    const ImS64 Count;
     typedef ImPlotPoint value_type;
 };
 
@@ -591,14 +729,14 @@ struct ImPlotPoint3D {
 
 template <typename _IndexerX, typename _IndexerY, typename _IndexerZ>
 struct GetterXYZ {
-  GetterXYZ(_IndexerX x, _IndexerY y, _IndexerZ z, int count) : IndxerX(x), IndxerY(y), IndxerZ(z), Count(count) { }
+  GetterXYZ(_IndexerX x, _IndexerY y, _IndexerZ z, ImS64 count) : IndxerX(x), IndxerY(y), IndxerZ(z), Count(count) { }
   template <typename I> IMPLOT_INLINE ImPlotPoint3D operator()(I idx) const {
     return ImPlotPoint3D(IndxerX[idx],IndxerY[idx],IndxerZ[idx]);
   }
   const _IndexerX IndxerX;
   const _IndexerY IndxerY;
   const _IndexerZ IndxerZ;
-  const int Count;
+  const ImS64 Count;
 };
 
 /// Interprets a user's function pointer as ImPlotPoints
@@ -609,11 +747,11 @@ struct GetterFuncPtr {
         Count(count)
     { }
     template <typename I> IMPLOT_INLINE ImPlotPoint operator[](I idx) const {
-        return Getter(idx, Data);
+        return Getter((int)idx, Data);
     }
     ImPlotGetter Getter;
     void* const Data;
-    const int Count;
+    const ImS64 Count;
     typedef ImPlotPoint value_type;
 };
 
@@ -627,7 +765,7 @@ struct GetterOverrideX {
     }
     const _Getter Getter;
     const double X;
-    const int Count;
+    const ImS64 Count;
     typedef ImPlotPoint value_type;
 };
 
@@ -641,7 +779,31 @@ struct GetterOverrideY {
     }
     const _Getter Getter;
     const double Y;
-    const int Count;
+    const ImS64 Count;
+    typedef ImPlotPoint value_type;
+};
+
+// Reads a contiguous run of an ImPlotDecimatedSeries: raw samples at level -1, otherwise two points per min/max bin
+// (its minimum and maximum, in the order they occurred)
+struct GetterMinMax {
+    GetterMinMax(const ImPlotDecimatedSeries& series, int level, int first, int count) :
+        Series(series),
+        Level(level),
+        First(first),
+        Count(level < 0 ? count : 2 * count)
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator[](I idx) const {
+        const int i = (int)idx;
+        if (Level < 0)
+            return ImPlotPoint(Series.Xs[First + i], Series.Ys[First + i]);
+        const ImPlotMinMaxBin& bin = Series.Levels[Level][First + i / 2];
+        const bool lead = (i & 1) == 0;
+        return ImPlotPoint(lead ? bin.X0 : bin.X1, lead == bin.MinFirst ? bin.YMin : bin.YMax);
+    }
+    const ImPlotDecimatedSeries& Series;
+    const int Level;
+    const int First;
+    const ImS64 Count;
     typedef ImPlotPoint value_type;
 };
 
@@ -649,17 +811,16 @@ template <typename _Getter>
 struct GetterLoop {
     GetterLoop(_Getter getter) : Getter(getter), Count(getter.Count + 1) { }
     template <typename I> IMPLOT_INLINE ImPlotPoint operator[](I idx) const {
-        idx = idx % (Count - 1);
-        return Getter[idx];
+        return Getter[(ImS64)idx % (Count - 1)];
     }
     const _Getter Getter;
-    const int Count;
+    const ImS64 Count;
     typedef ImPlotPoint value_type;
 };
 
 template <typename T>
 struct GetterError {
-    GetterError(const T* xs, const T* ys, const T* neg, const T* pos, int count, int offset, int stride) :
+    GetterError(const T* xs, const T* ys, const T* neg, const T* pos, ImS64 count, ImS64 offset, int stride) :
         Xs(xs),
         Ys(ys),
         Neg(neg),
@@ -678,8 +839,8 @@ struct GetterError {
     const T* const Ys;
     const T* const Neg;
     const T* const Pos;
-    const int Count;
-    const int Offset;
+    const ImS64 Count;
+    const ImS64 Offset;
     const int Stride;
     typedef ImPlotPointError value_type;
 };
@@ -703,7 +864,7 @@ struct GetterConstColor {
 };
 
 struct GetterIdxColor {
-    GetterIdxColor(const ImU32* data, int count, float alpha = 1.0f) : Data(data), Count(count), Alpha(alpha) { }
+    GetterIdxColor(const ImU32* data, ImS64 count, float alpha = 1.0f) : Data(data), Count(count), Alpha(alpha) { }
     template <typename I> IMPLOT_INLINE ImU32 operator[](I idx) const {
         IM_ASSERT(idx >= 0 && idx < Count);
         ImU32 col = Data[idx];
@@ -715,7 +876,7 @@ struct GetterIdxColor {
         return col;
     }
     const ImU32* Data;
-    const int Count;
+    const ImS64 Count;
     const float Alpha;
 };
 
@@ -730,13 +891,13 @@ struct GetterConstSize {
 };
 
 struct GetterIdxSize {
-    GetterIdxSize(const float* data, int count) : Data(data), Count(count) { }
+    GetterIdxSize(const float* data, ImS64 count) : Data(data), Count(count) { }
     template <typename I> IMPLOT_INLINE float operator[](I idx) const {
         IM_ASSERT(idx >= 0 && idx < Count);
         return Data[idx];
     }
     const float* Data;
-    const int Count;
+    const ImS64 Count;
 };
 
 //-----------------------------------------------------------------------------
@@ -747,7 +908,7 @@ template <typename _Getter1>
 struct Fitter1 {
     Fitter1(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter.Count; ++i) {
+        for (ImS64 i = 0; i < Getter.Count; ++i) {
             ImPlotPoint p = Getter[i];
             x_axis.ExtendFitWith(y_axis, p.x, p.y);
             y_axis.ExtendFitWith(x_axis, p.y, p.x);
@@ -760,7 +921,7 @@ template <typename _Getter1>
 struct FitterBubbles1 {
   FitterBubbles1(const _Getter1& getter) : Getter(getter) { }
   void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-    for (int i = 0; i < Getter.Count; ++i) {
+    for (ImS64 i = 0; i < Getter.Count; ++i) {
       ImPlotPoint3D p = Getter(i);
       double half_size = p.z;
       // Fit left and right edges
@@ -778,7 +939,7 @@ template <typename _Getter1>
 struct FitterX {
     FitterX(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis&) const {
-        for (int i = 0; i < Getter.Count; ++i) {
+        for (ImS64 i = 0; i < Getter.Count; ++i) {
             ImPlotPoint p = Getter[i];
             x_axis.ExtendFit(p.x);
         }
@@ -790,7 +951,7 @@ template <typename _Getter1>
 struct FitterY {
     FitterY(const _Getter1& getter) : Getter(getter) { }
     void Fit(ImPlotAxis&, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter.Count; ++i) {
+        for (ImS64 i = 0; i < Getter.Count; ++i) {
             ImPlotPoint p = Getter[i];
             y_axis.ExtendFit(p.y);
         }
@@ -802,12 +963,12 @@ template <typename _Getter1, typename _Getter2>
 struct Fitter2 {
     Fitter2(const _Getter1& getter1, const _Getter2& getter2) : Getter1(getter1), Getter2(getter2) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter1.Count; ++i) {
+        for (ImS64 i = 0; i < Getter1.Count; ++i) {
             ImPlotPoint p = Getter1[i];
             x_axis.ExtendFitWith(y_axis, p.x, p.y);
             y_axis.ExtendFitWith(x_axis, p.y, p.x);
         }
-        for (int i = 0; i < Getter2.Count; ++i) {
+        for (ImS64 i = 0; i < Getter2.Count; ++i) {
             ImPlotPoint p = Getter2[i];
             x_axis.ExtendFitWith(y_axis, p.x, p.y);
             y_axis.ExtendFitWith(x_axis, p.y, p.x);
@@ -825,8 +986,8 @@ struct FitterBarV {
         HalfWidth(width*0.5)
     { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        int count = ImMin(Getter1.Count, Getter2.Count);
-        for (int i = 0; i < count; ++i) {
+        const ImS64 count = ImMin(Getter1.Count, Getter2.Count);
+        for (ImS64 i = 0; i < count; ++i) {
             ImPlotPoint p1 = Getter1[i]; p1.x -= HalfWidth;
             ImPlotPoint p2 = Getter2[i]; p2.x += HalfWidth;
             x_axis.ExtendFitWith(y_axis, p1.x, p1.y);
@@ -848,8 +1009,8 @@ struct FitterBarH {
         HalfHeight(height*0.5)
     { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        int count = ImMin(Getter1.Count, Getter2.Count);
-        for (int i = 0; i < count; ++i) {
+        const ImS64 count = ImMin(Getter1.Count, Getter2.Count);
+        for (ImS64 i = 0; i < count; ++i) {
             ImPlotPoint p1 = Getter1[i]; p1.y -= HalfHeight;
             ImPlotPoint p2 = Getter2[i]; p2.y += HalfHeight;
             x_axis.ExtendFitWith(y_axis, p1.x, p1.y);
@@ -881,34 +1042,68 @@ struct FitterRect {
     const ImPlotPoint Pmax;
 };
 
+// Fits a whole ImPlotDecimatedSeries from the few bins of its coarsest pyramid level
+struct FitterMinMax {
+    FitterMinMax(const ImPlotDecimatedSeries& series) : Series(series) { }
+    void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        const ImVector<ImPlotMinMaxBin>& bins = Series.Levels[ImPlotDecimatedSeries::LevelCount - 1];
+        for (int i = 0; i < bins.Size; ++i) {
+            const ImPlotMinMaxBin& bin = bins[i];
+            x_axis.ExtendFitWith(y_axis, bin.X0, bin.YMin);
+            x_axis.ExtendFitWith(y_axis, bin.X1, bin.YMax);
+            y_axis.ExtendFitWith(x_axis, bin.YMin, bin.X0);
+            y_axis.ExtendFitWith(x_axis, bin.YMax, bin.X1);
+        }
+    }
+    const ImPlotDecimatedSeries& Series;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Transformers
 //-----------------------------------------------------------------------------
 
 struct Transformer1 {
-    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotTransform fwd, void* data) :
+    // Built-in scales are recognized at construction and evaluated inline instead of through TransformFwd. The inline
+    // log and symlog use ImLogFast, whose error is below 1.5e-9 scale units. On very narrow ranges that error could exceed
+    // a small fraction of a pixel, so they keep the exact TransformFwd (which the ticks and grid use as well).
+    enum Kind_ { Kind_Linear, Kind_Log10, Kind_SymLog, Kind_Custom };
+
+    Transformer1(double pixMin, double pltMin, double pltMax, double m, double scaMin, double scaMax, ImPlotScale scale, ImPlotTransform fwd, void* data) :
         ScaMin(scaMin),
         ScaMax(scaMax),
         PltMin(pltMin),
         PltMax(pltMax),
         PixMin(pixMin),
         M(m),
+        MS(m * (pltMax - pltMin) / (scaMax - scaMin)),
         TransformFwd(fwd),
-        TransformData(data)
+        TransformData(data),
+        Kind(fwd == nullptr                ? Kind_Linear :
+             ImAbs(MS) * 1.5e-9 > 0.01     ? Kind_Custom :
+             scale == ImPlotScale_Log10    ? Kind_Log10  :
+             scale == ImPlotScale_SymLog   ? Kind_SymLog : Kind_Custom)
     { }
 
     template <typename T> IMPLOT_INLINE float operator()(T p) const {
-        if (TransformFwd != nullptr) {
-            double s = TransformFwd(p, TransformData);
-            double t = (s - ScaMin) / (ScaMax - ScaMin);
-            p = PltMin + (PltMax - PltMin) * t;
+        switch (Kind) {
+        case Kind_Log10: {
+            const double v = (double)p <= 0.0 ? DBL_MIN : (double)p;
+            return (float)(PixMin + MS * (ImLog10Fast(v) - ScaMin));
+        }
+        case Kind_SymLog:
+            return (float)(PixMin + MS * (2.0 * ImAsinhFast((double)p / 2.0) - ScaMin));
+        case Kind_Custom:
+            return (float)(PixMin + MS * (TransformFwd((double)p, TransformData) - ScaMin));
+        default:
+            return (float)(PixMin + M * (p - PltMin));
         }
-        return (float)(PixMin + M * (p - PltMin));
     }
 
     double ScaMin, ScaMax, PltMin, PltMax, PixMin, M;
+    double MS; // pixels per scale unit
     ImPlotTransform TransformFwd;
     void*           TransformData;
+    Kind_           Kind;
 };
 
 struct Transformer2 {
@@ -919,6 +1114,7 @@ struct Transformer2 {
            x_axis.ScaleToPixel,
            x_axis.ScaleMin,
            x_axis.ScaleMax,
+           x_axis.Scale,
            x_axis.TransformForward,
            x_axis.TransformData),
         Ty(y_axis.PixelMin,
@@ -927,6 +1123,7 @@ struct Transformer2 {
            y_axis.ScaleToPixel,
            y_axis.ScaleMin,
            y_axis.ScaleMax,
+           y_axis.Scale,
            y_axis.TransformForward,
            y_axis.TransformData)
     { }
@@ -962,12 +1159,12 @@ struct Transformer2 {
 //-----------------------------------------------------------------------------
 
 struct RendererBase {
-    RendererBase(int prims, int idx_consumed, int vtx_consumed) :
+    RendererBase(ImS64 prims, int idx_consumed, int vtx_consumed) :
         Prims(prims),
         IdxConsumed(idx_consumed),
         VtxConsumed(vtx_consumed)
     { }
-    const int Prims;
+    const ImS64 Prims;
     Transformer2 Transformer;
     const int IdxConsumed;
     const int VtxConsumed;
@@ -986,7 +1183,7 @@ struct RendererLineStrip : RendererBase {
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P2 = this->Transformer(Getter[prim + 1]);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
@@ -1018,7 +1215,7 @@ struct RendererLineStripSkip : RendererBase {
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P2 = this->Transformer(Getter[prim + 1]);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             if (!ImNan(P2.x) && !ImNan(P2.y))
@@ -1050,7 +1247,7 @@ struct RendererLineSegments1 : RendererBase {
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P1 = this->Transformer(Getter[prim*2+0]);
         ImVec2 P2 = this->Transformer(Getter[prim*2+1]);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
@@ -1078,7 +1275,7 @@ struct RendererLineSegments2 : RendererBase {
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P1 = this->Transformer(Getter1[prim]);
         ImVec2 P2 = this->Transformer(Getter2[prim]);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
@@ -1107,7 +1304,7 @@ struct RendererBarsFillV : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImPlotPoint p1 = Getter1[prim];
         ImPlotPoint p2 = Getter2[prim];
         p1.x += HalfWidth;
@@ -1146,7 +1343,7 @@ struct RendererBarsFillH : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImPlotPoint p1 = Getter1[prim];
         ImPlotPoint p2 = Getter2[prim];
         p1.y += HalfHeight;
@@ -1186,7 +1383,7 @@ struct RendererBarsLineV : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImPlotPoint p1 = Getter1[prim];
         ImPlotPoint p2 = Getter2[prim];
         p1.x += HalfWidth;
@@ -1227,7 +1424,7 @@ struct RendererBarsLineH : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImPlotPoint p1 = Getter1[prim];
         ImPlotPoint p2 = Getter2[prim];
         p1.y += HalfHeight;
@@ -1269,7 +1466,7 @@ struct RendererStairsPre : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P2 = this->Transformer(Getter[prim + 1]);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
@@ -1301,7 +1498,7 @@ struct RendererStairsPost : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P2 = this->Transformer(Getter[prim + 1]);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
@@ -1333,7 +1530,7 @@ struct RendererStairsPreShaded : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P2 = this->Transformer(Getter[prim + 1]);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(Y0, P2.y));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(Y0, P2.y));
@@ -1366,7 +1563,7 @@ struct RendererStairsPostShaded : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P2 = this->Transformer(Getter[prim + 1]);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(P1.y, Y0));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(P1.y, Y0));
@@ -1402,7 +1599,7 @@ struct RendererShaded : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 P21 = this->Transformer(Getter1[prim+1]);
         ImVec2 P22 = this->Transformer(Getter2[prim+1]);
         ImRect rect(ImMin(ImMin(ImMin(P11,P12),P21),P22), ImMax(ImMax(ImMax(P11,P12),P21),P22));
@@ -1465,7 +1662,7 @@ struct RendererRectC : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         RectC rect = Getter[prim];
         ImVec2 P1 = this->Transformer(rect.Pos.x - rect.HalfSize.x , rect.Pos.y - rect.HalfSize.y);
         ImVec2 P2 = this->Transformer(rect.Pos.x + rect.HalfSize.x , rect.Pos.y + rect.HalfSize.y);
@@ -1485,15 +1682,17 @@ struct RendererRectC : RendererBase {
 /// Renders primitive shapes in bulk as efficiently as possible.
 template <class _Renderer>
 void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
-    unsigned int prims        = renderer.Prims;
+    IMPLOT_PROFILE_SCOPE("ImPlot::RenderPrimitives");
+    ImS64        prims        = renderer.Prims;
     unsigned int prims_culled = 0;
-    unsigned int idx          = 0;
+    ImS64        idx          = 0;
     renderer.Init(draw_list);
-    while (prims) {
-        // find how many can be reserved up to end of current draw command's limit
-        unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - draw_list._VtxCurrentIdx) / renderer.VtxConsumed);
+    const int vtx_start = draw_list.VtxBuffer.Size;
+    while (prims > 0) {
+        // find how many can be reserved up to end of current draw command's limit (bounded by ImDrawIdx, so it fits in 32 bits)
+        unsigned int cnt = (unsigned int)ImMin(prims, (ImS64)((MaxIdx<ImDrawIdx>::Value - draw_list._VtxCurrentIdx) / renderer.VtxConsumed));
         // make sure at least this many elements can be rendered to avoid situations where at the end of buffer this slow path is not taken all the time
-        if (cnt >= ImMin(64u, prims)) {
+        if (cnt >= (unsigned int)ImMin((ImS64)64, prims)) {
             if (prims_culled >= cnt)
                 prims_culled -= cnt; // reuse previous reservation
             else {
@@ -1508,18 +1707,25 @@ void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const
                 draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
                 prims_culled = 0;
             }
-            cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - 0/*draw_list._VtxCurrentIdx*/) / renderer.VtxConsumed);
+            cnt = (unsigned int)ImMin(prims, (ImS64)((MaxIdx<ImDrawIdx>::Value - 0/*draw_list._VtxCurrentIdx*/) / renderer.VtxConsumed));
             // reserve new draw command
             draw_list.PrimReserve(cnt * renderer.IdxConsumed, cnt * renderer.VtxConsumed);
         }
         prims -= cnt;
-        for (unsigned int ie = idx + cnt; idx != ie; ++idx) {
+        for (ImS64 ie = idx + cnt; idx != ie; ++idx) {
             if (!renderer.Render(draw_list, cull_rect, idx))
                 prims_culled++;
         }
     }
     if (prims_culled > 0)
         draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
+    // culled primitives are unreserved, so the rendered count follows from the vertices that remain
+    ImPlotContext& gp = *GImPlot;
+    if (gp.StatsEnabled) {
+        const int prims_rendered = (draw_list.VtxBuffer.Size - vtx_start) / renderer.VtxConsumed;
+        gp.StatsItem.Prims       += renderer.Prims;
+        gp.StatsItem.PrimsCulled += renderer.Prims - prims_rendered;
+    }
 }
 
 template <template <class> class _Renderer, class _Getter, typename ...Args>
@@ -1560,7 +1766,7 @@ struct RendererMarkersFill : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 p = this->Transformer(Getter[prim]);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             ImU32 col = GetterColor[prim];
@@ -1606,7 +1812,7 @@ struct RendererMarkersLine : RendererBase {
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImVec2 p = this->Transformer(Getter[prim]);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             ImU32 col = GetterColor[prim];
@@ -1640,7 +1846,7 @@ struct RendererCircleFill : RendererBase {
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImPlotPoint3D p3D = Getter(prim);
         float size_in_plot_coords = (float)p3D.z;
         float radius_in_plot_coords = size_in_plot_coords;
@@ -1721,7 +1927,7 @@ struct RendererCircleLine : RendererBase {
     void Init(ImDrawList& draw_list) const {
       GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
-    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
         ImPlotPoint3D p3D = Getter(prim);
         float size_in_plot_coords = (float)p3D.z;
         float radius_in_plot_coords = size_in_plot_coords;
@@ -1901,9 +2107,10 @@ void RenderColoredMarkers(const _Getter& getter, const ImPlotNextItemData& s) {
 // [SECTION] PlotLine
 //-----------------------------------------------------------------------------
 
-template <typename _Getter>
-void PlotLineEx(const char* label_id, const _Getter& getter, const ImPlotSpec& spec) {
-    if (BeginItemEx(label_id, Fitter1<_Getter>(getter), spec, spec.LineColor, spec.Marker)) {
+template <typename _Getter, typename _Fitter>
+void PlotLineEx(const char* label_id, const _Getter& getter, const _Fitter& fitter, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotLine");
+    if (BeginItemEx(label_id, fitter, spec, spec.LineColor, spec.Marker)) {
         if (getter.Count <= 0) {
             EndItem();
             return;
@@ -1976,21 +2183,38 @@ void PlotLineEx(const char* label_id, const _Getter& getter, const ImPlotSpec& s
     }
 }
 
+template <typename _Getter>
+void PlotLineEx(const char* label_id, const _Getter& getter, const ImPlotSpec& spec) {
+    PlotLineEx(label_id, getter, Fitter1<_Getter>(getter), spec);
+}
+
 template <typename T>
-void PlotLine(const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec) {
+void PlotLine64(const char* label_id, const T* values, ImS64 count, double xscale, double x0, const ImPlotSpec& spec) {
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,spec.Offset,Stride<T>(spec)),count);
     PlotLineEx(label_id, getter, spec);
 }
 
 template <typename T>
-void PlotLine(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec) {
+void PlotLine(const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec) {
+    PlotLine64(label_id, values, (ImS64)ImMax(count, 0), xscale, x0, spec);
+}
+
+template <typename T>
+void PlotLine64(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec) {
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,spec.Offset,Stride<T>(spec)),IndexerIdx<T>(ys,count,spec.Offset,Stride<T>(spec)),count);
     PlotLineEx(label_id, getter, spec);
 }
 
+template <typename T>
+void PlotLine(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec) {
+    PlotLine64(label_id, xs, ys, (ImS64)ImMax(count, 0), spec);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotLine<T> (const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec); \
-    template IMPLOT_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec);
+    template IMPLOT_API void PlotLine64<T>(const char* label_id, const T* values, ImS64 count, double xscale, double x0, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotLine64<T>(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -2000,12 +2224,359 @@ void PlotLineG(const char* label_id, ImPlotGetter getter_func, void* data, int c
     PlotLineEx(label_id, getter, spec);
 }
 
+// scaled
+template <typename T>
+void PlotLineScaled(const char* label_id, const T* values, int count, double scale, double bias, double xscale, double x0, const ImPlotSpec& spec) {
+    GetterXY<IndexerLin,IndexerScaled<T>> getter(IndexerLin(xscale,x0),IndexerScaled<T>(values,count,scale,bias,spec.Offset,Stride<T>(spec)),count);
+    PlotLineEx(label_id, getter, spec);
+}
+
+template <typename T>
+void PlotLineScaled(const char* label_id, const T* xs, const T* ys, int count, double scale, double bias, const ImPlotSpec& spec) {
+    GetterXY<IndexerIdx<T>,IndexerScaled<T>> getter(IndexerIdx<T>(xs,count,spec.Offset,Stride<T>(spec)),IndexerScaled<T>(ys,count,scale,bias,spec.Offset,Stride<T>(spec)),count);
+    PlotLineEx(label_id, getter, spec);
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void PlotLineScaled<T>(const char* label_id, const T* values, int count, double scale, double bias, double xscale, double x0, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotLineScaled<T>(const char* label_id, const T* xs, const T* ys, int count, double scale, double bias, const ImPlotSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+INSTANTIATE_MACRO(ImPlotHalf)
+#undef INSTANTIATE_MACRO
+
+// records
+template <typename T>
+void PlotLineRecords(const char* label_id, const T* xs, const T* ys, int count, int record_size, const ImPlotSpec& spec) {
+    GetterXY<IndexerRecord<T>,IndexerRecord<T>> getter(IndexerRecord<T>(xs,record_size),IndexerRecord<T>(ys,record_size),count);
+    PlotLineEx(label_id, getter, spec);
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void PlotLineRecords<T>(const char* label_id, const T* xs, const T* ys, int count, int record_size, const ImPlotSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+// streaming
+void PlotLine(const char* label_id, const ImPlotStreamBuffer& buffer, const ImPlotSpec& spec) {
+    const int count = buffer.Size(), offset = buffer.Offset();
+    GetterXY<IndexerRing<double>,IndexerRing<double>> getter(IndexerRing<double>(buffer.Xs,count,offset),IndexerRing<double>(buffer.Ys,count,offset),count);
+    PlotLineEx(label_id, getter, spec);
+}
+
+// Finds the first index of the sorted data #xs whose value is not less than #v
+template <typename _Indexer>
+static inline ImS64 LowerBoundIdx(const _Indexer& xs, ImS64 count, double v) {
+    ImS64 lo = 0, hi = count;
+    while (lo < hi) {
+        const ImS64 mid = lo + (hi - lo) / 2;
+        if (xs[mid] < v)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+// Selects the visible samples of a decimated series at the coarsest pyramid level that keeps ~2 points per pixel
+static GetterMinMax GetVisibleMinMax(const ImPlotDecimatedSeries& series, const ImPlotAxis& x_axis) {
+    const int n = series.Size();
+    // keep one sample beyond each edge so that lines leaving the plot area are still drawn
+    const int i0 = ImMax((int)LowerBoundIdx(series.Xs.Data, n, x_axis.Range.Min) - 1, 0);
+    const int i1 = ImMin((int)LowerBoundIdx(series.Xs.Data, n, x_axis.Range.Max) + 1, n);
+    const int pixels = ImMax(1, (int)x_axis.PixelSize());
+    if (i1 - i0 <= 2 * pixels)
+        return GetterMinMax(series, -1, i0, i1 - i0);
+    int level = 0;
+    int span  = ImPlotDecimatedSeries::LevelFactor;
+    for (; level < ImPlotDecimatedSeries::LevelCount - 1; ++level, span *= ImPlotDecimatedSeries::LevelFactor) {
+        if ((i1 - 1) / span - i0 / span + 1 <= pixels)
+            break;
+    }
+    const int b0 = i0 / span;
+    const int b1 = (i1 - 1) / span;
+    return GetterMinMax(series, level, b0, b1 - b0 + 1);
+}
+
+// decimated
+void PlotLine(const char* label_id, const ImPlotDecimatedSeries& series, const ImPlotSpec& spec) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    const ImPlotPlot& plot = *gp.CurrentPlot;
+    GetterMinMax getter = GetVisibleMinMax(series, plot.Axes[plot.CurrentX]);
+    PlotLineEx(label_id, getter, FitterMinMax(series), spec);
+}
+
+// Maximum number of records read to fit the y-axis of a mapped series whose x-axis is also being fit
+constexpr int MAPPED_FIT_SAMPLES = 4096;
+
+// Fits x to the first and last records of a sorted mapped series, and y to the visible records
+template <typename T>
+struct FitterMapped {
+    FitterMapped(const IndexerIdx<T>& xs, const IndexerIdx<T>& ys, ImS64 first, ImS64 last) :
+        Xs(xs),
+        Ys(ys),
+        First(first),
+        Last(last)
+    { }
+    void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        const ImS64 count = Xs.Count;
+        if (count <= 0)
+            return;
+        x_axis.ExtendFit(Xs[0]);
+        x_axis.ExtendFit(Xs[count - 1]);
+        // refitting x brings every record into view, so sample them sparsely instead of faulting in every page
+        ImS64 first = First, last = Last, step = 1;
+        if (x_axis.FitThisFrame) {
+            first = 0;
+            last  = count;
+            step  = ImMax((ImS64)1, count / MAPPED_FIT_SAMPLES);
+        }
+        for (ImS64 i = first; i < last; i += step)
+            y_axis.ExtendFitWith(x_axis, Ys[i], Xs[i]);
+    }
+    const IndexerIdx<T> Xs;
+    const IndexerIdx<T> Ys;
+    const ImS64 First;
+    const ImS64 Last;
+};
+
+template <typename T>
+void PlotLineMapped(const char* label_id, const ImPlotMappedFile& file, ImS64 count, size_t x_offset, size_t y_offset, const ImPlotSpec& spec) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
+    const int stride = Stride<T>(spec);
+    if (count <= 0 || !file.IsOpen()) {
+        count    = 0;
+        x_offset = y_offset = 0;
+    }
+    IM_ASSERT_USER_ERROR(count == 0 || ImMax(x_offset, y_offset) + (size_t)(count - 1) * stride + sizeof(T) <= file.Size, "PlotLineMapped() records exceed the size of the mapped file!");
+    SetupLock();
+    const unsigned char* base = (const unsigned char*)file.Data;
+    const T* xs_data = (const T*)(const void*)(base + x_offset);
+    const T* ys_data = (const T*)(const void*)(base + y_offset);
+    IndexerIdx<T> xs(xs_data, count, spec.Offset, stride);
+    IndexerIdx<T> ys(ys_data, count, spec.Offset, stride);
+    // binary search the visible records, keeping one beyond each edge so that lines leaving the plot area are drawn
+    const ImPlotPlot& plot   = *gp.CurrentPlot;
+    const ImPlotRange& range = plot.Axes[plot.CurrentX].Range;
+    const ImS64 first = ImMax(LowerBoundIdx(xs, count, range.Min) - 1, (ImS64)0);
+    const ImS64 last  = ImMin(LowerBoundIdx(xs, count, range.Max) + 1, count);
+    // without an offset, the visible records are a plain strided run starting at the first one
+    const bool rotated = xs.Offset != 0;
+    const size_t skip  = rotated ? 0 : (size_t)first * stride;
+    const ImS64 vis_count  = rotated ? count : last - first;
+    const ImS64 vis_offset = rotated ? xs.Offset + first : 0;
+    GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>((const T*)(const void*)((const unsigned char*)xs_data + skip), vis_count, vis_offset, stride),
+                                                 IndexerIdx<T>((const T*)(const void*)((const unsigned char*)ys_data + skip), vis_count, vis_offset, stride),
+                                                 last - first);
+    PlotLineEx(label_id, getter, FitterMapped<T>(xs, ys, first, last), spec);
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void PlotLineMapped<T>(const char* label_id, const ImPlotMappedFile& file, ImS64 count, size_t x_offset, size_t y_offset, const ImPlotSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+static ImPlotAsyncAxis GetAsyncAxis(const ImPlotAxis& axis) {
+    ImPlotAsyncAxis async;
+    async.Min           = axis.Range.Min;
+    async.Max           = axis.Range.Max;
+    async.ScaleMin      = axis.ScaleMin;
+    async.ScaleMax      = axis.ScaleMax;
+    async.Pixels        = axis.PixelMax - axis.PixelMin;
+    async.Transform     = axis.TransformForward;
+    async.TransformData = axis.TransformData;
+    return async;
+}
+
+// Remaps pixel-space values computed for one state of an axis to its current state (exact while the transform is unchanged)
+struct TransformerAsync {
+    TransformerAsync(const ImPlotAsyncAxis& from, const ImPlotAxis& to) {
+        const double pixels = to.PixelMax - to.PixelMin;
+        const double span   = to.ScaleMax - to.ScaleMin;
+        M = (float)(pixels / from.Pixels * (from.ScaleMax - from.ScaleMin) / span);
+        B = (float)(to.PixelMin + pixels * (from.ScaleMin - to.ScaleMin) / span);
+    }
+    IMPLOT_INLINE float operator()(float p) const { return M * p + B; }
+    float M, B;
+};
+
+// Fits the data extents found by the last completed job of an ImPlotAsyncSeries
+struct FitterAsync {
+    FitterAsync(const ImPlotAsyncSeries& series) : Series(series) { }
+    void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
+        if (!Series.HasResult)
+            return;
+        const ImPlotRect& b = Series.Bounds;
+        x_axis.ExtendFitWith(y_axis, b.X.Min, b.Y.Min);
+        y_axis.ExtendFitWith(x_axis, b.Y.Min, b.X.Min);
+        x_axis.ExtendFitWith(y_axis, b.X.Max, b.Y.Max);
+        y_axis.ExtendFitWith(x_axis, b.Y.Max, b.X.Max);
+    }
+    const ImPlotAsyncSeries& Series;
+};
+
+struct RendererAsyncLine {
+    RendererAsyncLine(const ImPlotAsyncSeries& series, const ImPlotAxis& x_axis, const ImPlotAxis& y_axis, ImU32 col, float weight) :
+        Prims(series.Points.Size - 1),
+        IdxConsumed(6),
+        VtxConsumed(4),
+        Points(series.Points.Data),
+        Tx(series.ResultX, x_axis),
+        Ty(series.ResultY, y_axis),
+        Col(col),
+        HalfWeight(ImMax(1.0f,weight)*0.5f)
+    {
+        P1 = ImVec2(Tx(Points[0].x), Ty(Points[0].y));
+    }
+    void Init(ImDrawList& draw_list) const {
+        GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
+    }
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
+        ImVec2 P2 = ImVec2(Tx(Points[prim + 1].x), Ty(Points[prim + 1].y));
+        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+            P1 = P2;
+            return false;
+        }
+        PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
+        P1 = P2;
+        return true;
+    }
+    const ImS64 Prims;
+    const int IdxConsumed;
+    const int VtxConsumed;
+    const ImVec2* Points;
+    const TransformerAsync Tx;
+    const TransformerAsync Ty;
+    const ImU32 Col;
+    mutable float HalfWeight;
+    mutable ImVec2 P1;
+    mutable ImVec2 UV0;
+    mutable ImVec2 UV1;
+};
+
+// asynchronous
+void PlotLine(const char* label_id, ImPlotAsyncSeries& series, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotLine");
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    const ImPlotPlot& plot   = *gp.CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    if (BeginItemEx(label_id, FitterAsync(series), spec, spec.LineColor, ImPlotMarker_None)) {
+        // hidden items do not keep the worker busy
+        series.Update(GetAsyncAxis(x_axis), GetAsyncAxis(y_axis));
+        const ImPlotNextItemData& s = GetItemData();
+        // points computed for another scale cannot be remapped, so nothing is drawn until a job catches up
+        const bool remappable = series.ResultX.Transform == x_axis.TransformForward && series.ResultX.TransformData == x_axis.TransformData &&
+                                series.ResultY.Transform == y_axis.TransformForward && series.ResultY.TransformData == y_axis.TransformData &&
+                                series.ResultX.Pixels != 0 && series.ResultY.Pixels != 0;
+        if (s.RenderLine && series.Points.Size > 1 && remappable)
+            RenderPrimitivesEx(RendererAsyncLine(series, x_axis, y_axis, ImGui::GetColorU32(s.Spec.LineColor), s.Spec.LineWeight), *GetPlotDrawList(), plot.PlotRect);
+        EndItem();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotLines
+//-----------------------------------------------------------------------------
+
+// Line strip whose x values were transformed to pixels up front, once for all the series sharing them (see PlotLines)
+template <class _IndexerY>
+struct RendererLineStripSharedX : RendererBase {
+    RendererLineStripSharedX(const float* xs_px, const _IndexerY& ys, int count, ImU32 col, float weight) :
+        RendererBase(count - 1, 6, 4),
+        Xs(xs_px),
+        Ys(ys),
+        Col(col),
+        HalfWeight(ImMax(1.0f,weight)*0.5f)
+    {
+        P1 = ImVec2(Xs[0], this->Transformer.Ty(Ys[0]));
+    }
+    void Init(ImDrawList& draw_list) const {
+        GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
+    }
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
+        ImVec2 P2 = ImVec2(Xs[prim + 1], this->Transformer.Ty(Ys[prim + 1]));
+        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+            P1 = P2;
+            return false;
+        }
+        PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
+        P1 = P2;
+        return true;
+    }
+    const float* Xs;
+    const _IndexerY& Ys;
+    const ImU32 Col;
+    mutable float HalfWeight;
+    mutable ImVec2 P1;
+    mutable ImVec2 UV0;
+    mutable ImVec2 UV1;
+};
+
+template <typename T>
+void PlotLinesEx(const char* const label_ids[], const T* xs, int x_stride, const T* const ys[], int y_stride, int series, int count, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotLines");
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    const IndexerIdx<T> indexer_x(xs, count, spec.Offset, x_stride);
+    const bool shared = count > 1 && spec.Marker == ImPlotMarker_None && spec.LineColors == nullptr &&
+                        (spec.Flags & (ImPlotLineFlags_Segments | ImPlotLineFlags_Loop | ImPlotLineFlags_Shaded | ImPlotLineFlags_SkipNaN)) == 0;
+    float* xs_px = nullptr; // transformed when the first series is drawn, so hidden series never pay for it
+    for (int s = 0; s < series; ++s) {
+        const IndexerIdx<T> indexer_y(ys[s], count, spec.Offset, y_stride);
+        GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(indexer_x, indexer_y, count);
+        if (!shared) {
+            PlotLineEx(label_ids[s], getter, spec);
+            continue;
+        }
+        if (BeginItemEx(label_ids[s], Fitter1<GetterXY<IndexerIdx<T>,IndexerIdx<T>>>(getter), spec, spec.LineColor, spec.Marker)) {
+            const ImPlotNextItemData& d = GetItemData();
+            if (d.RenderLine) {
+                if (xs_px == nullptr) {
+                    const Transformer2 transformer;
+                    xs_px = gp.FrameArena.AllocArray<float>(count);
+                    for (int i = 0; i < count; ++i)
+                        xs_px[i] = transformer.Tx(indexer_x[i]);
+                }
+                RenderPrimitivesEx(RendererLineStripSharedX<IndexerIdx<T>>(xs_px, indexer_y, count, ImGui::GetColorU32(d.Spec.LineColor), d.Spec.LineWeight), *GetPlotDrawList(), gp.CurrentPlot->PlotRect);
+            }
+            EndItem();
+        }
+    }
+}
+
+template <typename T>
+void PlotLines(const char* const label_ids[], const T* xs, const T* const ys[], int series, int count, const ImPlotSpec& spec) {
+    PlotLinesEx(label_ids, xs, Stride<T>(spec), ys, Stride<T>(spec), series, count, spec);
+}
+
+template <typename T>
+void PlotLines(const char* const label_ids[], const T* xs, const T* ys, int series, int count, const ImPlotSpec& spec) {
+    const T** columns = GImPlot->FrameArena.AllocArray<const T*>(series);
+    for (int s = 0; s < series; ++s)
+        columns[s] = ys + s;
+    const int y_stride = spec.Stride == IMPLOT_AUTO ? series * (int)sizeof(T) : spec.Stride;
+    PlotLinesEx(label_ids, xs, Stride<T>(spec), columns, y_stride, series, count, spec);
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void PlotLines<T>(const char* const label_ids[], const T* xs, const T* const ys[], int series, int count, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotLines<T>(const char* const label_ids[], const T* xs, const T* ys, int series, int count, const ImPlotSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotScatter
 //-----------------------------------------------------------------------------
 
 template <typename Getter>
 void PlotScatterEx(const char* label_id, const Getter& getter, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotScatter");
     // force scatter to render a marker even if none
     ImPlotMarker marker = spec.Marker == ImPlotMarker_None ? ImPlotMarker_Auto: spec.Marker;
     if (BeginItemEx(label_id, Fitter1<Getter>(getter), spec, spec.MarkerLineColor, marker)) {
@@ -2026,20 +2597,32 @@ void PlotScatterEx(const char* label_id, const Getter& getter, const ImPlotSpec&
 }
 
 template <typename T>
-void PlotScatter(const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec) {
+void PlotScatter64(const char* label_id, const T* values, ImS64 count, double xscale, double x0, const ImPlotSpec& spec) {
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,spec.Offset, Stride<T>(spec)),count);
     PlotScatterEx(label_id, getter, spec);
 }
 
 template <typename T>
-void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec) {
+void PlotScatter(const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec) {
+    PlotScatter64(label_id, values, (ImS64)ImMax(count, 0), xscale, x0, spec);
+}
+
+template <typename T>
+void PlotScatter64(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec) {
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,spec.Offset, Stride<T>(spec)),IndexerIdx<T>(ys,count,spec.Offset, Stride<T>(spec)),count);
     return PlotScatterEx(label_id, getter, spec);
 }
 
+template <typename T>
+void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec) {
+    PlotScatter64(label_id, xs, ys, (ImS64)ImMax(count, 0), spec);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec); \
-    template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec);
+    template IMPLOT_API void PlotScatter64<T>(const char* label_id, const T* values, ImS64 count, double xscale, double x0, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotScatter64<T>(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -2049,12 +2632,52 @@ void PlotScatterG(const char* label_id, ImPlotGetter getter_func, void* data, in
     return PlotScatterEx(label_id, getter, spec);
 }
 
+// scaled
+template <typename T>
+void PlotScatterScaled(const char* label_id, const T* values, int count, double scale, double bias, double xscale, double x0, const ImPlotSpec& spec) {
+    GetterXY<IndexerLin,IndexerScaled<T>> getter(IndexerLin(xscale,x0),IndexerScaled<T>(values,count,scale,bias,spec.Offset,Stride<T>(spec)),count);
+    PlotScatterEx(label_id, getter, spec);
+}
+
+template <typename T>
+void PlotScatterScaled(const char* label_id, const T* xs, const T* ys, int count, double scale, double bias, const ImPlotSpec& spec) {
+    GetterXY<IndexerIdx<T>,IndexerScaled<T>> getter(IndexerIdx<T>(xs,count,spec.Offset,Stride<T>(spec)),IndexerScaled<T>(ys,count,scale,bias,spec.Offset,Stride<T>(spec)),count);
+    PlotScatterEx(label_id, getter, spec);
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void PlotScatterScaled<T>(const char* label_id, const T* values, int count, double scale, double bias, double xscale, double x0, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotScatterScaled<T>(const char* label_id, const T* xs, const T* ys, int count, double scale, double bias, const ImPlotSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+INSTANTIATE_MACRO(ImPlotHalf)
+#undef INSTANTIATE_MACRO
+
+// records
+template <typename T>
+void PlotScatterRecords(const char* label_id, const T* xs, const T* ys, int count, int record_size, const ImPlotSpec& spec) {
+    GetterXY<IndexerRecord<T>,IndexerRecord<T>> getter(IndexerRecord<T>(xs,record_size),IndexerRecord<T>(ys,record_size),count);
+    PlotScatterEx(label_id, getter, spec);
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void PlotScatterRecords<T>(const char* label_id, const T* xs, const T* ys, int count, int record_size, const ImPlotSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+// streaming
+void PlotScatter(const char* label_id, const ImPlotStreamBuffer& buffer, const ImPlotSpec& spec) {
+    const int count = buffer.Size(), offset = buffer.Offset();
+    GetterXY<IndexerRing<double>,IndexerRing<double>> getter(IndexerRing<double>(buffer.Xs,count,offset),IndexerRing<double>(buffer.Ys,count,offset),count);
+    return PlotScatterEx(label_id, getter, spec);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotBubbles
 //-----------------------------------------------------------------------------
 
 template <typename Getter>
 void PlotBubblesEx(const char* label_id, const Getter& getter, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotBubbles");
     if (BeginItemEx(label_id, FitterBubbles1<Getter>(getter), spec, spec.FillColor, spec.Marker)) {
         if (getter.Count <= 0) {
             EndItem();
@@ -2111,6 +2734,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename Getter>
 void PlotPolygonEx(const char* label_id, const Getter& getter, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotPolygon");
     if (BeginItemEx(label_id, Fitter1<Getter>(getter), spec, spec.FillColor, spec.Marker)) {
         if (getter.Count < 2) {
             EndItem();
@@ -2129,29 +2753,30 @@ void PlotPolygonEx(const char* label_id, const Getter& getter, const ImPlotSpec&
         bool y_inv = ImHasFlag(y_axis.Flags, ImPlotAxisFlags_Invert);
         bool flip = !((x_inv ? 1 : 0) ^ (y_inv ? 1 : 0));
 
-        // Transform all points to screen space
-        ImVec2* points = (ImVec2*)IM_ALLOC(getter.Count * sizeof(ImVec2));
-        for (int i = 0; i < getter.Count; ++i) {
-            ImPlotPoint p = flip ? getter[getter.Count - 1 - i] : getter[i];
+        // Transform all points to screen space (ImDrawList takes an int point count)
+        IM_ASSERT(getter.Count <= INT_MAX);
+        const int count = (int)getter.Count;
+        ImVec2* points = GImPlot->FrameArena.AllocArray<ImVec2>(count);
+        for (int i = 0; i < count; ++i) {
+            ImPlotPoint p = flip ? getter[count - 1 - i] : getter[i];
             points[i] = transformer(p);
         }
 
-        if (s.RenderFill && getter.Count >= 3) {
+        if (s.RenderFill && count >= 3) {
             const ImU32 col_fill = ImGui::GetColorU32(s.Spec.FillColor);
             if (is_concave)
-                draw_list.AddConcavePolyFilled(points, getter.Count, col_fill);
+                draw_list.AddConcavePolyFilled(points, count, col_fill);
             else
-                draw_list.AddConvexPolyFilled(points, getter.Count, col_fill);
+                draw_list.AddConvexPolyFilled(points, count, col_fill);
         }
-        if (s.RenderLine && getter.Count >= 2) {
+        if (s.RenderLine && count >= 2) {
             const ImU32 col_line = ImGui::GetColorU32(s.Spec.LineColor);
 #if IMGUI_VERSION_NUM < 19276
-            draw_list.AddPolyline(points, getter.Count, col_line, ImDrawFlags_Closed, s.Spec.LineWeight);
+            draw_list.AddPolyline(points, count, col_line, ImDrawFlags_Closed, s.Spec.LineWeight);
 #else
-            draw_list.AddPolyline(points, getter.Count, col_line, s.Spec.LineWeight, ImDrawFlags_Closed);
+            draw_list.AddPolyline(points, count, col_line, s.Spec.LineWeight, ImDrawFlags_Closed);
 #endif
         }
-        IM_FREE(points);
 
         EndItem();
     }
@@ -2174,6 +2799,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename Getter>
 void PlotStairsEx(const char* label_id, const Getter& getter, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotStairs");
     if (BeginItemEx(label_id, Fitter1<Getter>(getter), spec, spec.LineColor, spec.Marker)) {
         if (getter.Count <= 0) {
             EndItem();
@@ -2233,20 +2859,32 @@ void PlotStairsEx(const char* label_id, const Getter& getter, const ImPlotSpec&
 }
 
 template <typename T>
-void PlotStairs(const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec) {
+void PlotStairs64(const char* label_id, const T* values, ImS64 count, double xscale, double x0, const ImPlotSpec& spec) {
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,spec.Offset,Stride<T>(spec)),count);
     PlotStairsEx(label_id, getter, spec);
 }
 
 template <typename T>
-void PlotStairs(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec) {
+void PlotStairs(const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec) {
+    PlotStairs64(label_id, values, (ImS64)ImMax(count, 0), xscale, x0, spec);
+}
+
+template <typename T>
+void PlotStairs64(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec) {
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,spec.Offset,Stride<T>(spec)),IndexerIdx<T>(ys,count,spec.Offset,Stride<T>(spec)),count);
     return PlotStairsEx(label_id, getter, spec);
 }
 
+template <typename T>
+void PlotStairs(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec) {
+    PlotStairs64(label_id, xs, ys, (ImS64)ImMax(count, 0), spec);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotStairs<T> (const char* label_id, const T* values, int count, double xscale, double x0, const ImPlotSpec& spec); \
-    template IMPLOT_API void PlotStairs<T>(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec);
+    template IMPLOT_API void PlotStairs64<T>(const char* label_id, const T* values, ImS64 count, double xscale, double x0, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotStairs<T>(const char* label_id, const T* xs, const T* ys, int count, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotStairs64<T>(const char* label_id, const T* xs, const T* ys, ImS64 count, const ImPlotSpec& spec);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -2262,6 +2900,7 @@ void PlotStairsG(const char* label_id, ImPlotGetter getter_func, void* data, int
 
 template <typename Getter1, typename Getter2>
 void PlotShadedEx(const char* label_id, const Getter1& getter1, const Getter2& getter2, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotShaded");
     if (BeginItemEx(label_id, Fitter2<Getter1,Getter2>(getter1,getter2), spec, spec.FillColor)) {
         if (getter1.Count <= 0 || getter2.Count <= 0) {
             EndItem();
@@ -2283,7 +2922,7 @@ void PlotShadedEx(const char* label_id, const Getter1& getter1, const Getter2& g
 }
 
 template <typename T>
-void PlotShaded(const char* label_id, const T* values, int count, double y_ref, double xscale, double x0, const ImPlotSpec& spec) {
+void PlotShaded64(const char* label_id, const T* values, ImS64 count, double y_ref, double xscale, double x0, const ImPlotSpec& spec) {
     if (!(y_ref > -DBL_MAX))
         y_ref = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO).Y.Min;
     if (!(y_ref < DBL_MAX))
@@ -2294,7 +2933,12 @@ void PlotShaded(const char* label_id, const T* values, int count, double y_ref,
 }
 
 template <typename T>
-void PlotShaded(const char* label_id, const T* xs, const T* ys, int count, double y_ref, const ImPlotSpec& spec) {
+void PlotShaded(const char* label_id, const T* values, int count, double y_ref, double xscale, double x0, const ImPlotSpec& spec) {
+    PlotShaded64(label_id, values, (ImS64)ImMax(count, 0), y_ref, xscale, x0, spec);
+}
+
+template <typename T>
+void PlotShaded64(const char* label_id, const T* xs, const T* ys, ImS64 count, double y_ref, const ImPlotSpec& spec) {
     if (y_ref == -HUGE_VAL)
         y_ref = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO).Y.Min;
     if (y_ref == HUGE_VAL)
@@ -2304,18 +2948,31 @@ void PlotShaded(const char* label_id, const T* xs, const T* ys, int count, doubl
     PlotShadedEx(label_id, getter1, getter2, spec);
 }
 
+template <typename T>
+void PlotShaded(const char* label_id, const T* xs, const T* ys, int count, double y_ref, const ImPlotSpec& spec) {
+    PlotShaded64(label_id, xs, ys, (ImS64)ImMax(count, 0), y_ref, spec);
+}
+
 
 template <typename T>
-void PlotShaded(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, const ImPlotSpec& spec) {
+void PlotShaded64(const char* label_id, const T* xs, const T* ys1, const T* ys2, ImS64 count, const ImPlotSpec& spec) {
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter1(IndexerIdx<T>(xs,count,spec.Offset,Stride<T>(spec)),IndexerIdx<T>(ys1,count,spec.Offset,Stride<T>(spec)),count);
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter2(IndexerIdx<T>(xs,count,spec.Offset,Stride<T>(spec)),IndexerIdx<T>(ys2,count,spec.Offset,Stride<T>(spec)),count);
     PlotShadedEx(label_id, getter1, getter2, spec);
 }
 
+template <typename T>
+void PlotShaded(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, const ImPlotSpec& spec) {
+    PlotShaded64(label_id, xs, ys1, ys2, (ImS64)ImMax(count, 0), spec);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* values, int count, double y_ref, double xscale, double x0, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotShaded64<T>(const char* label_id, const T* values, ImS64 count, double y_ref, double xscale, double x0, const ImPlotSpec& spec); \
     template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* xs, const T* ys, int count, double y_ref, const ImPlotSpec& spec); \
-    template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, const ImPlotSpec& spec);
+    template IMPLOT_API void PlotShaded64<T>(const char* label_id, const T* xs, const T* ys, ImS64 count, double y_ref, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, const ImPlotSpec& spec); \
+    template IMPLOT_API void PlotShaded64<T>(const char* label_id, const T* xs, const T* ys1, const T* ys2, ImS64 count, const ImPlotSpec& spec);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -2332,6 +2989,7 @@ void PlotShadedG(const char* label_id, ImPlotGetter getter_func1, void* data1, I
 
 template <typename Getter1, typename Getter2>
 void PlotBarsVEx(const char* label_id, const Getter1& getter1, const Getter2 getter2, double width, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotBars");
     if (BeginItemEx(label_id, FitterBarV<Getter1,Getter2>(getter1,getter2,width), spec, spec.FillColor)) {
         if (getter1.Count <= 0 || getter2.Count <= 0) {
             EndItem();
@@ -2368,6 +3026,7 @@ void PlotBarsVEx(const char* label_id, const Getter1& getter1, const Getter2 get
 
 template <typename Getter1, typename Getter2>
 void PlotBarsHEx(const char* label_id, const Getter1& getter1, const Getter2& getter2, double height, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotBars");
     if (BeginItemEx(label_id, FitterBarH<Getter1,Getter2>(getter1,getter2,height), spec, spec.FillColor)) {
         if (getter1.Count <= 0 || getter2.Count <= 0) {
             EndItem();
@@ -2455,16 +3114,17 @@ void PlotBarsG(const char* label_id, ImPlotGetter getter_func, void* data, int c
 
 template <typename T>
 void PlotBarGroups(const char* const label_ids[], const T* values, int item_count, int group_count, double group_size, double shift, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotBarGroups");
     IndexerIdx<T> indexer(values,item_count*group_count,spec.Offset,Stride<T>(spec));
     const bool horz = ImHasFlag(spec.Flags, ImPlotBarGroupsFlags_Horizontal);
     const bool stack = ImHasFlag(spec.Flags, ImPlotBarGroupsFlags_Stacked);
     ImPlotSpec spec_bars = spec;
     spec_bars.Flags = 0;
+    spec_bars.ItemID = 0;
     if (stack) {
         SetupLock();
         ImPlotContext& gp = *GImPlot;
-        gp.TempDouble1.resize(4*group_count);
-        double* temp = gp.TempDouble1.Data;
+        double* temp = gp.FrameArena.AllocArray<double>(4*group_count);
         double* neg =      &temp[0];
         double* pos =      &temp[group_count];
         double* curr_min = &temp[group_count*2];
@@ -2473,7 +3133,8 @@ void PlotBarGroups(const char* const label_ids[], const T* values, int item_coun
             temp[g] = 0;
         if (horz) {
             for (int i = 0; i < item_count; ++i) {
-                if (!IsItemHidden(label_ids[i])) {
+                spec_bars.ItemID = gp.CurrentItems->GetItemID(label_ids[i]);
+                if (!IsItemHiddenByID(spec_bars.ItemID)) {
                     for (int g = 0; g < group_count; ++g) {
                         double v = indexer[i*group_count+g];
                         if (v > 0) {
@@ -2495,7 +3156,8 @@ void PlotBarGroups(const char* const label_ids[], const T* values, int item_coun
         }
         else {
             for (int i = 0; i < item_count; ++i) {
-                if (!IsItemHidden(label_ids[i])) {
+                spec_bars.ItemID = gp.CurrentItems->GetItemID(label_ids[i]);
+                if (!IsItemHiddenByID(spec_bars.ItemID)) {
                     for (int g = 0; g < group_count; ++g) {
                         double v = indexer[i*group_count+g];
                         if (v > 0) {
@@ -2544,6 +3206,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename _GetterPos, typename _GetterNeg>
 void PlotErrorBarsVEx(const char* label_id, const _GetterPos& getter_pos, const _GetterNeg& getter_neg, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotErrorBars");
     if (BeginItemEx(label_id, Fitter2<_GetterPos,_GetterNeg>(getter_pos, getter_neg), spec, IMPLOT_AUTO_COL)) {
         if (getter_pos.Count <= 0 || getter_neg.Count <= 0) {
             EndItem();
@@ -2554,7 +3217,7 @@ void PlotErrorBarsVEx(const char* label_id, const _GetterPos& getter_pos, const
         const ImU32 col = ImGui::GetColorU32( IsColorAuto(spec.LineColor) ? ImGui::GetStyleColorVec4(ImGuiCol_Text) : s.Spec.LineColor );
         const bool rend_whisker  = s.Spec.Size > 0;
         const float half_whisker = s.Spec.Size * 0.5f;
-        for (int i = 0; i < getter_pos.Count; ++i) {
+        for (ImS64 i = 0; i < getter_pos.Count; ++i) {
             ImVec2 p1 = PlotToPixels(getter_neg[i],IMPLOT_AUTO,IMPLOT_AUTO);
             ImVec2 p2 = PlotToPixels(getter_pos[i],IMPLOT_AUTO,IMPLOT_AUTO);
             draw_list.AddLine(p1,p2,col, s.Spec.LineWeight);
@@ -2569,6 +3232,7 @@ void PlotErrorBarsVEx(const char* label_id, const _GetterPos& getter_pos, const
 
 template <typename _GetterPos, typename _GetterNeg>
 void PlotErrorBarsHEx(const char* label_id, const _GetterPos& getter_pos, const _GetterNeg& getter_neg, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotErrorBars");
     if (BeginItemEx(label_id, Fitter2<_GetterPos,_GetterNeg>(getter_pos, getter_neg), spec, IMPLOT_AUTO_COL)) {
         if (getter_pos.Count <= 0 || getter_neg.Count <= 0) {
             EndItem();
@@ -2579,7 +3243,7 @@ void PlotErrorBarsHEx(const char* label_id, const _GetterPos& getter_pos, const
         const ImU32 col = ImGui::GetColorU32( IsColorAuto(spec.LineColor) ? ImGui::GetStyleColorVec4(ImGuiCol_Text) : s.Spec.LineColor );
         const bool rend_whisker  = s.Spec.Size > 0;
         const float half_whisker = s.Spec.Size * 0.5f;
-        for (int i = 0; i < getter_pos.Count; ++i) {
+        for (ImS64 i = 0; i < getter_pos.Count; ++i) {
             ImVec2 p1 = PlotToPixels(getter_neg[i],IMPLOT_AUTO,IMPLOT_AUTO);
             ImVec2 p2 = PlotToPixels(getter_pos[i],IMPLOT_AUTO,IMPLOT_AUTO);
             draw_list.AddLine(p1, p2, col, s.Spec.LineWeight);
@@ -2632,6 +3296,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename _GetterM, typename _GetterB>
 void PlotStemsEx(const char* label_id, const _GetterM& getter_mark, const _GetterB& getter_base, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotStems");
     if (BeginItemEx(label_id, Fitter2<_GetterM,_GetterB>(getter_mark,getter_base), spec, spec.LineColor, spec.Marker)) {
         if (getter_mark.Count <= 0 || getter_base.Count <= 0) {
             EndItem();
@@ -2700,6 +3365,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename T>
 void PlotInfLines(const char* label_id, const T* values, int count, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotInfLines");
     const ImPlotRect lims = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO);
     if (ImHasFlag(spec.Flags, ImPlotInfLinesFlags_Horizontal)) {
         GetterXY<IndexerConst,IndexerIdx<T>> getter_min(IndexerConst(lims.X.Min),IndexerIdx<T>(values,count,spec.Offset,Stride<T>(spec)),count);
@@ -2926,6 +3592,7 @@ double PieChartSum(IndexerIdx<T> indexer, bool ignore_hidden) {
 
 template <typename T>
 void PlotPieChartEx(const char* const label_ids[], IndexerIdx<T> indexer, ImPlotPoint center, double radius, double angle0, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotPieChart");
     ImDrawList& draw_list  = *GetPlotDrawList();
 
     const bool ignore_hidden = ImHasFlag(spec.Flags, ImPlotPieChartFlags_IgnoreHidden);
@@ -3171,6 +3838,7 @@ void RenderHeatmap(ImDrawList& draw_list, IndexerIdx<T> indexer, int rows, int c
 
 template <typename T>
 void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHeatmap");
     if (BeginItemEx(label_id, FitterRect(bounds_min, bounds_max), spec)) {
         if (rows <= 0 || cols <= 0) {
             EndItem();
@@ -3193,6 +3861,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename T>
 double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram");
 
     const bool cumulative = ImHasFlag(spec.Flags, ImPlotHistogramFlags_Cumulative);
     const bool density    = ImHasFlag(spec.Flags, ImPlotHistogramFlags_Density);
@@ -3214,10 +3883,8 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
         width = range.Size() / bins;
 
     ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_centers = gp.TempDouble1;
-    ImVector<double>& bin_counts  = gp.TempDouble2;
-    bin_centers.resize(bins);
-    bin_counts.resize(bins);
+    double* bin_centers = gp.FrameArena.AllocArray<double>(bins);
+    double* bin_counts  = gp.FrameArena.AllocArray<double>(bins);
     int below = 0;
 
     for (int b = 0; b < bins; ++b) {
@@ -3265,11 +3932,11 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
     ImPlotSpec spec_bars = spec;
     if (ImHasFlag(spec.Flags, ImPlotHistogramFlags_Horizontal)) {
         spec_bars.Flags = ImPlotBarsFlags_Horizontal;
-        PlotBars(label_id, &bin_counts.Data[0], &bin_centers.Data[0], bins, bar_scale*width, spec_bars);
+        PlotBars(label_id, bin_counts, bin_centers, bins, bar_scale*width, spec_bars);
     }
     else {
         spec_bars.Flags = 0;
-        PlotBars(label_id, &bin_centers.Data[0], &bin_counts.Data[0], bins, bar_scale*width, spec_bars);
+        PlotBars(label_id, bin_centers, bin_counts, bins, bar_scale*width, spec_bars);
     }
     return max_count;
 }
@@ -3283,6 +3950,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename T>
 double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotHistogram2D");
 
     // const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative); NOT SUPPORTED
     const bool density  = ImHasFlag(spec.Flags, ImPlotHistogramFlags_Density);
@@ -3315,8 +3983,7 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
     const int bins = x_bins * y_bins;
 
     ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_counts = gp.TempDouble1;
-    bin_counts.resize(bins);
+    double* bin_counts = gp.FrameArena.AllocArray<double>(bins);
 
     for (int b = 0; b < bins; ++b)
         bin_counts[b] = 0;
@@ -3347,7 +4014,7 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
             return max_count;
         }
         ImDrawList& draw_list = *GetPlotDrawList();
-        IndexerIdx<double> indexer_bin(bin_counts.begin(), y_bins*x_bins, 0, sizeof(double));
+        IndexerIdx<double> indexer_bin(bin_counts, y_bins*x_bins, 0, sizeof(double));
         RenderHeatmap(draw_list, indexer_bin, y_bins, x_bins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj);
         EndItem();
     }
@@ -3366,6 +4033,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename Getter>
 void PlotDigitalEx(const char* label_id, Getter getter, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotDigital");
     if (BeginItem(label_id, spec, spec.FillColor)) {
         ImPlotContext& gp = *GImPlot;
         ImDrawList& draw_list = *GetPlotDrawList();
@@ -3448,6 +4116,7 @@ void PlotImage(const char* label_id, ImTextureRef tex_ref, const ImPlotPoint& bm
 #else
 void PlotImage(const char* label_id, ImTextureID tex_ref, const ImPlotPoint& bmin, const ImPlotPoint& bmax, const ImVec2& uv0, const ImVec2& uv1, const ImVec4& tint_col, const ImPlotSpec& spec) {
 #endif
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotImage");
     if (BeginItemEx(label_id, FitterRect(bmin,bmax), spec)) {
         ImU32 tint_col32 = ImGui::ColorConvertFloat4ToU32(tint_col);
         GetCurrentItem()->Color = tint_col32;
@@ -3466,6 +4135,7 @@ void PlotImage(const char* label_id, ImTextureID tex_ref, const ImPlotPoint& bmi
 //-----------------------------------------------------------------------------
 
 void PlotText(const char* text, double x, double y, const ImVec2& pixel_offset, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotText");
     IM_ASSERT_USER_ERROR(GImPlot->CurrentPlot != nullptr, "PlotText() needs to be called between BeginPlot() and EndPlot()!");
     SetupLock();
     ImDrawList & draw_list = *GetPlotDrawList();
@@ -3498,6 +4168,7 @@ void PlotText(const char* text, double x, double y, const ImVec2& pixel_offset,
 //-----------------------------------------------------------------------------
 
 void PlotDummy(const char* label_id, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::PlotDummy");
     // Pick the first non-auto color from the spec to override the legend icon color
     ImVec4 item_col = spec.LineColor;
     if (IsColorAuto(item_col))
@@ -3510,6 +4181,173 @@ void PlotDummy(const char* label_id, const ImPlotSpec& spec) {
         EndItem();
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Sparklines
+//-----------------------------------------------------------------------------
+
+// Maps sample indices and values straight to pixels, without the axes of a plot
+struct TransformerSparkline {
+    TransformerSparkline(const ImRect& rect, int count, double y_min, double y_max) :
+        X0(rect.Min.x),
+        Y0(rect.Max.y),
+        MX(count > 1 ? rect.GetWidth() / (count - 1) : 0.0f),
+        MY(-rect.GetHeight() / (y_max - y_min)),
+        YMin(y_min)
+    { }
+    IMPLOT_INLINE ImVec2 operator()(int idx, double y) const {
+        return ImVec2(X0 + MX * idx, (float)(Y0 + MY * (y - YMin)));
+    }
+    const float  X0, Y0, MX;
+    const double MY, YMin;
+};
+
+template <class _Indexer>
+struct RendererSparklineLine {
+    RendererSparklineLine(const _Indexer& indexer, const TransformerSparkline& transformer, ImU32 col, float weight) :
+        Prims(indexer.Count - 1),
+        IdxConsumed(6),
+        VtxConsumed(4),
+        Indexer(indexer),
+        Transformer(transformer),
+        Col(col),
+        HalfWeight(ImMax(1.0f,weight)*0.5f)
+    {
+        P1 = Transformer(0, Indexer[0]);
+    }
+    void Init(ImDrawList& draw_list) const {
+        GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
+    }
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
+        ImVec2 P2 = Transformer(prim + 1, Indexer[prim + 1]);
+        if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
+            P1 = P2;
+            return false;
+        }
+        PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
+        P1 = P2;
+        return true;
+    }
+    const ImS64 Prims;
+    const int IdxConsumed;
+    const int VtxConsumed;
+    const _Indexer& Indexer;
+    const TransformerSparkline& Transformer;
+    const ImU32 Col;
+    mutable float HalfWeight;
+    mutable ImVec2 P1;
+    mutable ImVec2 UV0;
+    mutable ImVec2 UV1;
+};
+
+// Fills between the line and a horizontal pixel baseline (see RendererShaded)
+template <class _Indexer>
+struct RendererSparklineFill {
+    RendererSparklineFill(const _Indexer& indexer, const TransformerSparkline& transformer, ImU32 col, float y0) :
+        Prims(indexer.Count - 1),
+        IdxConsumed(6),
+        VtxConsumed(5),
+        Indexer(indexer),
+        Transformer(transformer),
+        Col(col),
+        Y0(y0)
+    {
+        P1 = Transformer(0, Indexer[0]);
+    }
+    void Init(ImDrawList& draw_list) const {
+        UV = draw_list._Data->TexUvWhitePixel;
+    }
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, ImS64 prim) const {
+        ImVec2 P2 = Transformer(prim + 1, Indexer[prim + 1]);
+        const ImVec2 B1(P1.x, Y0);
+        const ImVec2 B2(P2.x, Y0);
+        if (!cull_rect.Overlaps(ImRect(ImMin(ImMin(P1,P2),B1), ImMax(ImMax(P1,P2),B2)))) {
+            P1 = P2;
+            return false;
+        }
+        const int intersect = (P1.y > Y0 && Y0 > P2.y) || (Y0 > P1.y && P2.y > Y0);
+        const ImVec2 intersection = intersect == 0 ? ImVec2(0,0) : Intersection(P1,P2,B1,B2);
+        draw_list._VtxWritePtr[0].pos = P1;
+        draw_list._VtxWritePtr[0].uv  = UV;
+        draw_list._VtxWritePtr[0].col = Col;
+        draw_list._VtxWritePtr[1].pos = P2;
+        draw_list._VtxWritePtr[1].uv  = UV;
+        draw_list._VtxWritePtr[1].col = Col;
+        draw_list._VtxWritePtr[2].pos = intersection;
+        draw_list._VtxWritePtr[2].uv  = UV;
+        draw_list._VtxWritePtr[2].col = Col;
+        draw_list._VtxWritePtr[3].pos = B1;
+        draw_list._VtxWritePtr[3].uv  = UV;
+        draw_list._VtxWritePtr[3].col = Col;
+        draw_list._VtxWritePtr[4].pos = B2;
+        draw_list._VtxWritePtr[4].uv  = UV;
+        draw_list._VtxWritePtr[4].col = Col;
+        draw_list._VtxWritePtr += 5;
+        draw_list._IdxWritePtr[0] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+        draw_list._IdxWritePtr[1] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1 + intersect);
+        draw_list._IdxWritePtr[2] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 3);
+        draw_list._IdxWritePtr[3] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+        draw_list._IdxWritePtr[4] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 4);
+        draw_list._IdxWritePtr[5] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 3 - intersect);
+        draw_list._IdxWritePtr += 6;
+        draw_list._VtxCurrentIdx += 5;
+        P1 = P2;
+        return true;
+    }
+    const ImS64 Prims;
+    const int IdxConsumed;
+    const int VtxConsumed;
+    const _Indexer& Indexer;
+    const TransformerSparkline& Transformer;
+    const ImU32 Col;
+    const float Y0;
+    mutable ImVec2 P1;
+    mutable ImVec2 UV;
+};
+
+template <typename T>
+void Sparkline(const char* id, const T* values, int count, double y_min, double y_max, const ImVec2& size, const ImPlotSpec& spec) {
+    IMPLOT_PROFILE_SCOPE("ImPlot::Sparkline");
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImGuiContext& G     = *GImGui;
+    ImGuiWindow* Window = G.CurrentWindow;
+    if (Window->SkipItems)
+        return;
+    const ImGuiID ID   = Window->GetID(id);
+    const ImVec2 frame_size = ImGui::CalcItemSize(size, ImGui::CalcItemWidth(), ImGui::GetFrameHeight());
+    const ImRect rect(Window->DC.CursorPos, Window->DC.CursorPos + frame_size);
+    ImGui::ItemSize(rect);
+    if (!ImGui::ItemAdd(rect, ID) || count < 2 || rect.GetWidth() <= 0 || rect.GetHeight() <= 0)
+        return;
+    IndexerIdx<T> indexer(values, count, spec.Offset, Stride<T>(spec));
+    if (!(y_min < y_max)) {
+        ImMinMaxIndexer(indexer, count, &y_min, &y_max);
+        if (!(y_min < y_max)) {
+            y_min -= 0.5;
+            y_max += 0.5;
+        }
+    }
+    const TransformerSparkline transformer(rect, count, y_min, y_max);
+    ImRect cull_rect = rect;
+    cull_rect.ClipWith(Window->ClipRect);
+    ImDrawList& draw_list = *Window->DrawList;
+    const ImVec4 line_col = IsColorAuto(spec.LineColor) ? ImGui::GetStyleColorVec4(ImGuiCol_PlotLines) : spec.LineColor;
+    // values outside of an explicit [y_min,y_max] map outside of rect, so clip to it rather than spill into neighbors
+    draw_list.PushClipRect(rect.Min, rect.Max, true);
+    if (ImHasFlag(spec.Flags, ImPlotLineFlags_Shaded)) {
+        ImVec4 fill_col = IsColorAuto(spec.FillColor) ? line_col : spec.FillColor;
+        fill_col.w *= spec.FillAlpha;
+        const float y0 = ImClamp(transformer(0, 0.0).y, rect.Min.y, rect.Max.y);
+        RenderPrimitivesEx(RendererSparklineFill<IndexerIdx<T>>(indexer, transformer, ImGui::GetColorU32(fill_col), y0), draw_list, cull_rect);
+    }
+    RenderPrimitivesEx(RendererSparklineLine<IndexerIdx<T>>(indexer, transformer, ImGui::GetColorU32(line_col), spec.LineWeight), draw_list, cull_rect);
+    draw_list.PopClipRect();
+}
+
+#define INSTANTIATE_MACRO(T) \
+    template IMPLOT_API void Sparkline<T>(const char* id, const T* values, int count, double y_min, double y_max, const ImVec2& size, const ImPlotSpec& spec);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 } // namespace ImPlot
 
 #endif // #ifndef IMGUI_DISABLE